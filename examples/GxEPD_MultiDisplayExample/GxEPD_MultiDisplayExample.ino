@@ -72,6 +72,11 @@
 #include <GxIO/GxIO_SPI/GxIO_SPI.h>
 #include <GxIO/GxIO.h>
 
+// sends the data to the next display while the previous one refreshes, needs separate BUSY lines for overlap
+#include <GxEPD_BusScheduler/GxEPD_BusScheduler.h>
+
+GxEPD_BusScheduler scheduler;
+
 #if defined(ESP8266)
 
 // create GxIO_SPI instances for each display, each instance with different CS line;
@@ -383,10 +388,35 @@ void loop()
   Serial.println("showFont(display4, \"FreeMonoBold9pt7b\", &FreeMonoBold9pt7b)");
   showFont(display4, "FreeMonoBold9pt7b", &FreeMonoBold9pt7b);
 #endif
+  Serial.println("showFontOnAll(\"FreeMonoBold12pt7b\", &FreeMonoBold12pt7b)");
+  showFontOnAll("FreeMonoBold12pt7b", &FreeMonoBold12pt7b);
   delay(10000);
 }
 
+void showFontOnAll(const char name[], const GFXfont* f)
+{
+  drawFont(display1, name, f);
+  drawFont(display2, name, f);
+  drawFont(display3, name, f);
+  scheduler.addUpdate(display1);
+  scheduler.addUpdate(display2);
+  scheduler.addUpdate(display3);
+#if defined(ESP32)
+  drawFont(display4, name, f);
+  scheduler.addUpdate(display4);
+#endif
+  scheduler.run(); // returns when all displays are refreshed
+  delay(5000);
+}
+
 void showFont(GxEPD& display, const char name[], const GFXfont* f)
+{
+  drawFont(display, name, f);
+  display.update();
+  delay(5000);
+}
+
+void drawFont(GxEPD& display, const char name[], const GFXfont* f)
 {
   display.fillScreen(GxEPD_WHITE);
   display.setTextColor(GxEPD_BLACK);
@@ -403,6 +433,4 @@ void showFont(GxEPD& display, const char name[], const GFXfont* f)
 #endif
   display.println("`abcdefghijklmno");
   display.println("pqrstuvwxyz{|}~ ");
-  display.update();
-  delay(5000);
 }
@@ -0,0 +1,227 @@
+// GxEPD_Bench : measures the drawing speed of display classes on the host, in pixels per second of CPU time
+// for drawPixel() in each rotation, with full buffer and in paged mode (drawPaged), for fillRect() and drawBitmap(),
+// and for drawPaged() of lines across the screen, and of text and boxes, with and without display list,
+// and with a page buffer of caller memory for the whole screen;
+// drawPaged() of text through GxIO_SPI and GxIO_SPI_Async in pixels per second of wall time, with 2us per byte
+// of simulated wire time (4MHz SPI clock), the worker of GxIO_SPI_Async sends while the next page is drawn
+//
+// usage : GxEPD_Bench [repeat]
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#include <GxEPD.h>
+#include <GxGDEW042T2/GxGDEW042T2.h>
+#include <GxGDEW075Z09/GxGDEW075Z09.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO_SPI_Async/GxIO_SPI_Async.h>
+#include "../GxIO_Record/GxIO_Record.h"
+#include <time.h>
+
+static const int8_t BUSY_PIN = 4;
+static const int8_t RST_PIN = 2;
+static const int8_t CS_PIN = 5;
+static const int8_t DC_PIN = 6;
+
+static int repeat = 10;
+static double draw_seconds;
+static uint32_t draw_pixels;
+
+static double now()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static double wallTime()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// SPI.onTransfer : simulated wire time of a byte at 4MHz
+static void wireTime(void* context, uint8_t d)
+{
+  double end = wallTime() + 2e-6;
+  while (wallTime() < end);
+}
+
+// IL0398 : BUSY low while busy, never busy
+static int notBusy(void*)
+{
+  return HIGH;
+}
+
+// every pixel once, black and white pattern
+static void drawPixels(GxEPD& display)
+{
+  double start = now();
+  int16_t w = display.width(), h = display.height();
+  for (int16_t y = 0; y < h; y++)
+  {
+    for (int16_t x = 0; x < w; x++)
+    {
+      display.drawPixel(x, y, ((x ^ y) & 1) ? GxEPD_BLACK : GxEPD_WHITE);
+    }
+  }
+  draw_seconds += now() - start;
+  draw_pixels += uint32_t(w) * h;
+}
+
+static void drawPagedPixels(const void* p)
+{
+  drawPixels(*(GxEPD*) p);
+}
+
+// boxes of 32 x 16 pixels and lines, covering the screen
+static void fillRects(GxEPD& display)
+{
+  double start = now();
+  int16_t w = display.width(), h = display.height();
+  for (int16_t y = 0; y < h; y += 16)
+  {
+    for (int16_t x = 0; x < w; x += 32)
+    {
+      display.fillRect(x, y, 32, 16, ((x ^ y) & 16) ? GxEPD_BLACK : GxEPD_WHITE);
+    }
+  }
+  draw_seconds += now() - start;
+  draw_pixels += uint32_t(w) * h;
+}
+
+// bitmaps of 64 x 64 pixels at byte aligned and unaligned x, covering the screen
+static void drawBitmaps(GxEPD& display, int16_t x_offset)
+{
+  static uint8_t bitmap[64 / 8 * 64];
+  for (uint16_t i = 0; i < sizeof(bitmap); i++) bitmap[i] = i * 37;
+  double start = now();
+  int16_t w = display.width(), h = display.height();
+  for (int16_t y = 0; y < h; y += 64)
+  {
+    for (int16_t x = x_offset; x < w; x += 64)
+    {
+      display.drawBitmap(bitmap, x, y, 64, 64, GxEPD_BLACK, GxEPD::bm_normal);
+    }
+  }
+  draw_seconds += now() - start;
+  draw_pixels += uint32_t(w) * h;
+}
+
+// text and boxes, as on a typical screen
+static void drawScreen(const void* p)
+{
+  GxEPD& display = *(GxEPD*) p;
+  display.setTextColor(GxEPD_BLACK);
+  for (int16_t y = 0; y + 30 < display.height(); y += 40)
+  {
+    display.drawRect(4, y + 4, display.width() - 8, 32, GxEPD_BLACK);
+    display.fillRect(8, y + 8, 24, 24, GxEPD_BLACK);
+    display.setCursor(40, y + 16);
+    display.print("GxEPD 0123456789");
+  }
+}
+
+// lines across all pages
+static void drawLines(const void* p)
+{
+  GxEPD& display = *(GxEPD*) p;
+  int16_t w = display.width(), h = display.height();
+  for (int16_t x = 0; x < w; x += 8)
+  {
+    display.drawLine(x, 0, w - 1 - x, h - 1, GxEPD_BLACK);
+  }
+}
+
+// all pages, by a drawPaged() call
+static void drawPagedScreen(GxEPD& display, void (*drawPaged)(GxEPD&))
+{
+  double start = now();
+  drawPaged(display);
+  draw_seconds += now() - start;
+  draw_pixels += uint32_t(display.width()) * display.height();
+}
+
+static void report(const char* driver, const char* op, uint8_t rotation)
+{
+  printf("%-14s %-10s %8u %12.1f\n", driver, op, rotation, draw_pixels / draw_seconds / 1000000.0);
+  draw_seconds = 0;
+  draw_pixels = 0;
+}
+
+template <class Display> static void bench(Display& display, const char* driver)
+{
+  display.init();
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    display.setRotation(r);
+    for (int i = 0; i < repeat; i++) drawPixels(display);
+    report(driver, "drawPixel", r);
+    display.drawPaged(drawPagedPixels, &display);
+    report(driver, "paged", r);
+    for (int i = 0; i < repeat; i++) fillRects(display);
+    report(driver, "fillRect", r);
+    for (int i = 0; i < repeat; i++) drawBitmaps(display, 0);
+    report(driver, "bitmap", r);
+    for (int i = 0; i < repeat; i++) drawBitmaps(display, 3);
+    report(driver, "bitmap+3", r);
+  }
+  display.setRotation(0);
+  static uint8_t list[16384];
+  static uint8_t page[2 * uint32_t(GxGDEW075Z09_WIDTH) * GxGDEW075Z09_HEIGHT / 8];
+  for (int i = 0; i < repeat; i++) drawPagedScreen(display, [](GxEPD& d) {((Display&) d).drawPaged(drawLines, &d);});
+  report(driver, "lines", 0);
+  for (int i = 0; i < repeat; i++) drawPagedScreen(display, [](GxEPD& d) {((Display&) d).drawPaged(drawScreen, &d);});
+  report(driver, "text", 0);
+  display.setDisplayList(list, sizeof(list));
+  for (int i = 0; i < repeat; i++) drawPagedScreen(display, [](GxEPD& d) {((Display&) d).drawPaged(drawScreen, &d);});
+  report(driver, "text+list", 0);
+  display.setDisplayList(0, 0);
+  display.setPageBuffer(page, sizeof(page));
+  for (int i = 0; i < repeat; i++) drawPagedScreen(display, [](GxEPD& d) {((Display&) d).drawPaged(drawScreen, &d);});
+  report(driver, "text+page", 0);
+  display.setPageBuffer(0, 0);
+}
+
+static void benchTransport(GxIO_SPI& io, const char* op)
+{
+  GxGDEW042T2 display(io, RST_PIN, BUSY_PIN);
+  display.init();
+  SPI.onTransfer = wireTime;
+  for (int i = 0; i < repeat; i++)
+  {
+    double start = wallTime();
+    display.drawPaged(drawScreen, &display);
+    draw_seconds += wallTime() - start;
+    draw_pixels += uint32_t(display.width()) * display.height();
+  }
+  SPI.onTransfer = 0;
+  report("GxGDEW042T2", op, 0);
+}
+
+int main(int argc, char** argv)
+{
+  if (argc > 1) repeat = atoi(argv[1]);
+  printf("%-14s %-10s %8s %12s\n", "driver", "operation", "rotation", "Mpixel/s");
+  {
+    GxIO_Record io(BUSY_PIN, LOW);
+    GxGDEW042T2 display(io, RST_PIN, BUSY_PIN);
+    bench(display, "GxGDEW042T2");
+  }
+  {
+    GxIO_Record io(BUSY_PIN, LOW);
+    GxGDEW075Z09 display(io, RST_PIN, BUSY_PIN);
+    bench(display, "GxGDEW075Z09");
+  }
+  hostAttachPinReader(BUSY_PIN, notBusy, 0);
+  {
+    GxIO_SPI io(SPI, CS_PIN, DC_PIN, RST_PIN);
+    benchTransport(io, "text+spi");
+  }
+  {
+    GxIO_SPI_Async io(SPI, CS_PIN, DC_PIN, RST_PIN, -1, GxGDEW042T2_PAGE_SIZE);
+    benchTransport(io, "text+async");
+  }
+  hostAttachPinReader(BUSY_PIN, 0, 0);
+  return 0;
+}
@@ -0,0 +1,237 @@
+// GxEPD_Record : runs display classes on the host with GxIO_Record, reports bytes on the wire per operation
+// and writes or compares the recorded command/data streams with golden streams;
+// checks that drawPaged() through GxIO_SPI_Async sends the same stream as through GxIO_SPI, observed with SPI.onTransfer
+//
+// usage : GxEPD_Record [-w | -c] [directory]
+//   -w : write the streams as golden streams to directory (default .)
+//   -c : compare the streams with the golden streams in directory, exit code 1 on difference
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#include <GxEPD.h>
+#include <GxGDEW042T2/GxGDEW042T2.h>
+#include <GxDEPG0213BN/GxDEPG0213BN.h>
+#include <GxGDE0213B1/GxGDE0213B1.h>
+#include <HINKE0154A35/HINKE0154A35.h>
+#include <HINKE042A11/HINKE042A11.h>
+#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <GxIO/GxIO_SPI_Async/GxIO_SPI_Async.h>
+#include "../GxIO_Record/GxIO_Record.h"
+#include <algorithm>
+
+static const int8_t BUSY_PIN = 4;
+static const int8_t RST_PIN = 2;
+static const int8_t CS_PIN = 5;
+static const int8_t DC_PIN = 6;
+
+enum Mode {report, write_golden, compare_golden};
+
+static Mode mode = report;
+static std::string directory = ".";
+static int differences = 0;
+
+static void drawContent(GxEPD& display)
+{
+  display.fillScreen(GxEPD_WHITE);
+  display.drawRect(2, 2, display.width() - 4, display.height() - 4, GxEPD_BLACK);
+  display.fillRect(10, 10, 40, 20, GxEPD_BLACK);
+  display.drawLine(0, 0, display.width() - 1, display.height() - 1, GxEPD_BLACK);
+  display.setTextColor(GxEPD_BLACK);
+  display.setCursor(10, 40);
+  display.print("GxEPD host");
+}
+
+static void drawPagedContent(const void* p)
+{
+  drawContent(*(GxEPD*) p);
+}
+
+static void operation(GxEPD& display, GxIO_Record& io, const char* driver, const char* op)
+{
+  std::string path = directory + "/" + driver + "_" + op + ".txt";
+  const GxEPD_Statistics& s = display.getStatistics();
+  printf("%-14s %-14s %8u %8u %8u %10u %10u %10u %10u %10u\n", driver, op, io.bytes(), io.commands(), io.transactions(), io.wireMicros(), io.busyMicros(),
+         s.wait_us[GxEPD::phase_power_on], s.wait_us[GxEPD::phase_refresh], s.wait_us[GxEPD::phase_power_off]);
+  display.resetStatistics();
+  if (mode == write_golden)
+  {
+    if (!io.writeTo(path.c_str())) printf("  can't write %s\n", path.c_str());
+  }
+  else if (mode == compare_golden)
+  {
+    int32_t diff = io.compareTo(path.c_str());
+    if (diff >= 0)
+    {
+      printf("  differs from %s at byte %d\n", path.c_str(), int(diff));
+      differences++;
+    }
+  }
+  io.clear();
+}
+
+// drawPaged() is not part of the GxEPD interface
+template <typename GxEPD_Type>
+static void run(GxEPD_Type& display, GxIO_Record& io, const char* driver)
+{
+  std::vector<uint8_t> shadow(display.shadowBufferSize());
+  GxEPD_DirtyRegions dirty;
+  GxEPD_BusyTimes busy_times = {};
+  display.setShadowBuffer(shadow.data());
+  display.setDirtyRegions(&dirty);
+  display.setBusyTimes(&busy_times);
+  display.init();
+  operation(display, io, driver, "init");
+  drawContent(display);
+  display.update();
+  operation(display, io, driver, "update");
+  display.updateAsync(); // same stream as update(), refresh completed by the state machine
+  while (display.isBusy()) delay(1);
+  operation(display, io, driver, "updateAsync");
+  display.fillRect(100, 50, 30, 30, GxEPD_BLACK);
+  display.updateWindow(100, 50, 30, 30);
+  operation(display, io, driver, "updateWindow");
+  display.fillRect(10, 60, 20, 10, GxEPD_BLACK);
+  display.drawPixel(display.width() - 20, display.height() - 20, GxEPD_BLACK);
+  display.updateDirty(); // one window around three regions, the region of updateWindow() above is still dirty
+  operation(display, io, driver, "updateDirty");
+  display.fillRect(display.width() - 40, 10, 24, 16, GxEPD_BLACK);
+  display.updateChanged(); // the whole screen, the shadow is invalidated by updateWindow() above
+  operation(display, io, driver, "updateChanged");
+  display.updateChanged(); // nothing changed
+  operation(display, io, driver, "unchanged");
+  display.fillRect(60, 20, 16, 8, GxEPD_BLACK);
+  display.updateDirty(); // the dirty region is copied to the shadow
+  operation(display, io, driver, "dirtyToShadow");
+  display.updateChanged(); // nothing changed since updateDirty()
+  operation(display, io, driver, "unchangedDirty");
+  display.drawPaged(drawPagedContent, &display);
+  operation(display, io, driver, "drawPaged");
+  display.eraseDisplay();
+  operation(display, io, driver, "eraseDisplay");
+}
+
+// drivers with own pixel mapping (drawPixel() override, no buffer layout) : content in each rotation
+static void runRotations(GxEPD& display, GxIO_Record& io, const char* driver)
+{
+  static const char* ops[] = {"update_r0", "update_r1", "update_r2", "update_r3"};
+  display.init();
+  operation(display, io, driver, "init");
+  for (uint8_t r = 0; r < 4; r++)
+  {
+    display.setRotation(r);
+    drawContent(display);
+    display.update();
+    operation(display, io, driver, ops[r]);
+  }
+  display.setRotation(0);
+  display.fillRect(10, 60, 20, 10, GxEPD_BLACK);
+  display.updateDirty(); // drawing not tracked without buffer layout, update()
+  operation(display, io, driver, "updateDirty");
+}
+
+// SPI.onTransfer : bytes with DC state, called by the worker of GxIO_SPI_Async for the asynchronous transfers
+static void recordTransfer(void* context, uint8_t d)
+{
+  GxIO_Record::Entry e = {digitalRead(DC_PIN) == HIGH, d};
+  ((std::vector<GxIO_Record::Entry>*) context)->push_back(e);
+}
+
+// IL0398 : BUSY low while busy, never busy
+static int notBusy(void*)
+{
+  return HIGH;
+}
+
+static void drawPagedSPI(GxIO_SPI& io, std::vector<GxIO_Record::Entry>& stream)
+{
+  GxGDEW042T2 display(io, RST_PIN, BUSY_PIN);
+  display.init();
+  SPI.onTransferContext = &stream;
+  SPI.onTransfer = recordTransfer;
+  display.drawPaged(drawPagedContent, &display);
+  io.waitTransferComplete();
+  SPI.onTransfer = 0;
+}
+
+static void runTransport()
+{
+  std::vector<GxIO_Record::Entry> sync_stream, async_stream;
+  hostAttachPinReader(BUSY_PIN, notBusy, 0);
+  {
+    GxIO_SPI io(SPI, CS_PIN, DC_PIN, RST_PIN);
+    drawPagedSPI(io, sync_stream);
+  }
+  {
+    GxIO_SPI_Async io(SPI, CS_PIN, DC_PIN, RST_PIN, -1, GxGDEW042T2_PAGE_SIZE);
+    drawPagedSPI(io, async_stream);
+  }
+  hostAttachPinReader(BUSY_PIN, 0, 0);
+  uint32_t commands = std::count_if(async_stream.begin(), async_stream.end(), [](const GxIO_Record::Entry& e) {return !e.dc;});
+  printf("%-14s %-14s %8u %8u\n", "GxIO_SPI_Async", "drawPaged", uint32_t(async_stream.size()), commands);
+  if ((sync_stream.size() != async_stream.size()) || !std::equal(sync_stream.begin(), sync_stream.end(), async_stream.begin()))
+  {
+    size_t n = std::min(sync_stream.size(), async_stream.size());
+    size_t diff = std::mismatch(sync_stream.begin(), sync_stream.begin() + n, async_stream.begin()).first - sync_stream.begin();
+    printf("  differs from the stream of GxIO_SPI at byte %d\n", int(diff));
+    differences++;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-w")) mode = write_golden;
+    else if (!strcmp(argv[i], "-c")) mode = compare_golden;
+    else directory = argv[i];
+  }
+  printf("%-14s %-14s %8s %8s %8s %10s %10s %10s %10s %10s\n", "driver", "operation", "bytes", "commands", "trans", "wire us", "busy us",
+         "on us", "refresh us", "off us");
+  {
+    // IL0398 : BUSY low while busy
+    GxIO_Record io(BUSY_PIN, LOW);
+    io.setBusyTime(0x04, 100000); // power on
+    io.setBusyTime(0x02, 20000); // power off
+    io.setBusyTime(0x12, 4000000); // display refresh, full update time
+    GxGDEW042T2 display(io, RST_PIN, BUSY_PIN);
+    run(display, io, "GxGDEW042T2");
+  }
+  {
+    // SSD1608 : BUSY high while busy
+    GxIO_Record io(BUSY_PIN, HIGH);
+    io.setBusyTime(0x12, 10000); // software reset
+    io.setBusyTime(0x20, 1500000); // master activation, full update time
+    GxDEPG0213BN display(io, RST_PIN, BUSY_PIN);
+    run(display, io, "GxDEPG0213BN");
+  }
+  {
+    // IL3895 : BUSY high while busy, y-decrement RAM addressing
+    GxIO_Record io(BUSY_PIN, HIGH);
+    io.setBusyTime(0x20, 1500000); // master activation, full update time
+    GxGDE0213B1 display(io, RST_PIN, BUSY_PIN);
+    runRotations(display, io, "GxGDE0213B1");
+    display.setRotation(1);
+    display.fillRect(20, 30, 40, 24, GxEPD_BLACK);
+    display.drawFastHLine(0, 70, display.width(), GxEPD_BLACK);
+    display.updateWindow(20, 30, 40, 24);
+    operation(display, io, "GxGDE0213B1", "updateWindow");
+    display.drawPaged(drawPagedContent, &display);
+    operation(display, io, "GxGDE0213B1", "drawPaged");
+    display.setRotation(0);
+  }
+  {
+    // 3-color HINK panels : BUSY high while busy, x and y swapped in drawPixel()
+    GxIO_Record io(BUSY_PIN, HIGH);
+    io.setBusyTime(0x20, 1500000); // master activation, full update time
+    HINKE0154A35 display(io, RST_PIN, BUSY_PIN);
+    runRotations(display, io, "HINKE0154A35");
+  }
+  {
+    GxIO_Record io(BUSY_PIN, HIGH);
+    io.setBusyTime(0x20, 1500000); // master activation, full update time
+    HINKE042A11 display(io, RST_PIN, BUSY_PIN);
+    runRotations(display, io, "HINKE042A11");
+  }
+  runTransport();
+  return differences ? 1 : 0;
+}
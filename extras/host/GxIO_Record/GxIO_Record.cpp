@@ -0,0 +1,342 @@
+// GxIO_Record : host io class for the GxEPD library, records the command/data stream instead of sending it
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#include "GxIO_Record.h"
+
+GxIO_Record::GxIO_Record(int8_t busy, uint8_t busy_level) :
+  _busy_time(256, 0), _reset_busy_time(0), _busy(busy), _busy_level(busy_level), _frequency(4000000),
+  _wire_ns(0), _wire_ns_pending(0), _busy_micros(0), _busy_start(0), _busy_end(0)
+{
+  if (_busy >= 0) hostAttachPinReader(_busy, _readBusy, this);
+}
+
+GxIO_Record::~GxIO_Record()
+{
+  if (_busy >= 0) hostAttachPinReader(_busy, 0, 0);
+}
+
+void GxIO_Record::setBusyTime(uint8_t command, uint32_t busy_us)
+{
+  _busy_time[command] = busy_us;
+}
+
+void GxIO_Record::setResetBusyTime(uint32_t busy_us)
+{
+  _reset_busy_time = busy_us;
+}
+
+void GxIO_Record::clear()
+{
+  _stream.clear();
+  resetStatistics();
+  _wire_ns = 0;
+  _busy_micros = 0;
+}
+
+uint32_t GxIO_Record::bytes() const
+{
+  return _stream.size();
+}
+
+uint32_t GxIO_Record::commands() const
+{
+  uint32_t n = 0;
+  for (size_t i = 0; i < _stream.size(); i++)
+  {
+    if (!_stream[i].dc) n++;
+  }
+  return n;
+}
+
+std::string GxIO_Record::toText() const
+{
+  std::string text;
+  char b[8];
+  uint8_t on_line = 0;
+  for (size_t i = 0; i < _stream.size(); i++)
+  {
+    const Entry& e = _stream[i];
+    if (!e.dc)
+    {
+      if (on_line) text += "\n";
+      snprintf(b, sizeof(b), "C %02x\n", e.value);
+      text += b;
+      on_line = 0;
+      continue;
+    }
+    snprintf(b, sizeof(b), on_line ? " %02x" : "D %02x", e.value);
+    text += b;
+    if (++on_line == 16)
+    {
+      text += "\n";
+      on_line = 0;
+    }
+  }
+  if (on_line) text += "\n";
+  return text;
+}
+
+bool GxIO_Record::writeTo(const char* path) const
+{
+  FILE* f = fopen(path, "w");
+  if (!f) return false;
+  std::string text = toText();
+  bool ok = fwrite(text.data(), 1, text.size(), f) == text.size();
+  return (fclose(f) == 0) && ok;
+}
+
+int32_t GxIO_Record::compareTo(const char* path) const
+{
+  std::vector<Entry> golden;
+  std::string text;
+  FILE* f = fopen(path, "r");
+  if (f)
+  {
+    char b[256];
+    size_t n;
+    while ((n = fread(b, 1, sizeof(b), f)) > 0) text.append(b, n);
+    fclose(f);
+  }
+  if (!f || !_parse(text.c_str(), golden)) return 0;
+  size_t n = golden.size() < _stream.size() ? golden.size() : _stream.size();
+  for (size_t i = 0; i < n; i++)
+  {
+    if (!(golden[i] == _stream[i])) return i;
+  }
+  return golden.size() == _stream.size() ? -1 : int32_t(n);
+}
+
+bool GxIO_Record::_parse(const char* text, std::vector<Entry>& stream)
+{
+  bool dc = true;
+  while (*text)
+  {
+    char* end;
+    if ((*text == ' ') || (*text == '\n') || (*text == '\r')) text++;
+    else if ((*text == 'C') || (*text == 'D'))
+    {
+      dc = (*text++ == 'D');
+    }
+    else
+    {
+      unsigned long value = strtoul(text, &end, 16);
+      if ((end == text) || (value > 0xFF)) return false;
+      Entry e = {dc, uint8_t(value)};
+      stream.push_back(e);
+      text = end;
+    }
+  }
+  return true;
+}
+
+int GxIO_Record::_readBusy(void* context)
+{
+  GxIO_Record* io = (GxIO_Record*) context;
+  bool busy = (micros() - io->_busy_start) < (io->_busy_end - io->_busy_start);
+  return busy ? io->_busy_level : !io->_busy_level;
+}
+
+void GxIO_Record::_setBusy(uint32_t busy_us)
+{
+  if (busy_us == 0) return;
+  _busy_start = micros();
+  _busy_end = _busy_start + busy_us;
+  _busy_micros += busy_us;
+}
+
+void GxIO_Record::_transaction()
+{
+  _statistics.transactions++;
+  _statistics.cs_toggles++;
+}
+
+void GxIO_Record::_record(bool dc, uint8_t value)
+{
+  Entry e = {dc, value};
+  _stream.push_back(e);
+  // 8 clocks per byte, the virtual clock advances by whole microseconds
+  uint32_t ns = uint32_t(8000000000ULL / _frequency);
+  _wire_ns += ns;
+  _wire_ns_pending += ns;
+  if (_wire_ns_pending >= 1000)
+  {
+    hostAdvanceMicros(_wire_ns_pending / 1000);
+    _statistics.transfer_us += _wire_ns_pending / 1000;
+    _wire_ns_pending %= 1000;
+  }
+  if (dc) _statistics.data_bytes++;
+  else _countCommand(value);
+  if (!dc) _setBusy(_busy_time[value]);
+}
+
+void GxIO_Record::reset()
+{
+  // same timing as GxIO_SPI with reset pin and BUSY pin
+  delay(20);
+  delay(20);
+  _setBusy(_reset_busy_time);
+  waitReady(_busy, _busy_level, 200);
+}
+
+void GxIO_Record::init()
+{
+  reset();
+}
+
+void GxIO_Record::setFrequency(uint32_t freq)
+{
+  if (freq > 0) _frequency = freq;
+}
+
+uint8_t GxIO_Record::transferTransaction(uint8_t d)
+{
+  _transaction();
+  _record(true, d);
+  _statistics.read_bytes++;
+  return 0xFF;
+}
+
+uint16_t GxIO_Record::transfer16Transaction(uint16_t d)
+{
+  _transaction();
+  _record(true, d >> 8);
+  _record(true, d & 0xFF);
+  _statistics.read_bytes += 2;
+  return 0xFFFF;
+}
+
+uint8_t GxIO_Record::readDataTransaction()
+{
+  _transaction();
+  _statistics.read_bytes++;
+  return 0xFF;
+}
+
+uint16_t GxIO_Record::readData16Transaction()
+{
+  _transaction();
+  _statistics.read_bytes += 2;
+  return 0xFFFF;
+}
+
+uint8_t GxIO_Record::readData()
+{
+  _statistics.read_bytes++;
+  return 0xFF;
+}
+
+uint16_t GxIO_Record::readData16()
+{
+  _statistics.read_bytes += 2;
+  return 0xFFFF;
+}
+
+uint32_t GxIO_Record::readRawData32(uint8_t part)
+{
+  return 0;
+}
+
+void GxIO_Record::writeCommandTransaction(uint8_t c)
+{
+  _transaction();
+  _record(false, c);
+}
+
+void GxIO_Record::writeDataTransaction(uint8_t d)
+{
+  _transaction();
+  _record(true, d);
+}
+
+void GxIO_Record::writeDataTransaction(const uint8_t* data, uint32_t n, bool invert)
+{
+  _transaction();
+  uint8_t mask = invert ? 0xFF : 0x00;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    _record(true, data[i] ^ mask);
+  }
+}
+
+void GxIO_Record::writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert)
+{
+  _transaction();
+  uint8_t mask = invert ? 0xFF : 0x00;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    _record(true, pgm_read_byte(&data[i]) ^ mask);
+  }
+}
+
+void GxIO_Record::writeCommandData(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  _transaction();
+  _record(false, c);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    _record(true, data[i]);
+  }
+}
+
+void GxIO_Record::writeCommandData(uint8_t c, uint8_t d)
+{
+  writeCommandData(c, &d, 1);
+}
+
+void GxIO_Record::writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  _transaction();
+  _record(false, c);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    _record(true, pgm_read_byte(&data[i]));
+  }
+}
+
+void GxIO_Record::writeData16Transaction(uint16_t d, uint32_t num)
+{
+  _transaction();
+  writeData16(d, num);
+}
+
+void GxIO_Record::writeCommand(uint8_t c)
+{
+  _record(false, c);
+}
+
+void GxIO_Record::writeData(uint8_t d)
+{
+  _record(true, d);
+}
+
+void GxIO_Record::writeData(uint8_t* d, uint32_t num)
+{
+  for (uint32_t i = 0; i < num; i++)
+  {
+    _record(true, d[i]);
+  }
+}
+
+void GxIO_Record::writeData16(uint16_t d, uint32_t num)
+{
+  for (uint32_t i = 0; i < num; i++)
+  {
+    _record(true, d >> 8);
+    _record(true, d & 0xFF);
+  }
+}
+
+void GxIO_Record::writeAddrMSBfirst(uint16_t d)
+{
+  writeData16(d);
+}
+
+void GxIO_Record::startTransaction()
+{
+  _transaction();
+}
+
+void GxIO_Record::endTransaction()
+{
+}
@@ -0,0 +1,114 @@
+// GxIO_Record : host io class for the GxEPD library, records the command/data stream instead of sending it
+//
+// each byte is recorded with its DC state (command or data), transactions and simulated wire time are counted.
+// BUSY is simulated : commands registered with setBusyTime() keep the BUSY pin active for the given time
+// on the virtual clock of the host shim, so _waitWhileBusy() of the display classes works unchanged.
+// the recorded stream can be written as text and compared to a golden stream written before.
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _GxIO_Record_H_
+#define _GxIO_Record_H_
+
+#include <GxIO/GxIO.h>
+#include <vector>
+
+#if !defined(GxEPD_STATISTICS)
+#error "GxIO_Record counts into the statistics, build with -DGxEPD_STATISTICS"
+#endif
+#include <string>
+
+class GxIO_Record : public GxIO
+{
+  public:
+    struct Entry
+    {
+      bool dc; // false : command, true : data
+      uint8_t value;
+      bool operator==(const Entry& other) const
+      {
+        return (dc == other.dc) && (value == other.value);
+      }
+    };
+    // busy_level : level of the BUSY pin while busy, LOW for IL0xxx controllers (GDEW), HIGH for SSD16xx (GDEH, DEPG)
+    GxIO_Record(int8_t busy = -1, uint8_t busy_level = HIGH);
+    ~GxIO_Record();
+    const char* name = "GxIO_Record";
+    // BUSY active for busy_us after command, replaces previous time for command
+    void setBusyTime(uint8_t command, uint32_t busy_us);
+    // BUSY active for busy_us after reset()
+    void setResetBusyTime(uint32_t busy_us);
+    // clear stream and counters, including GxIO statistics, keeps BUSY simulation state
+    void clear();
+    const std::vector<Entry>& stream() const
+    {
+      return _stream;
+    };
+    uint32_t bytes() const;
+    uint32_t commands() const;
+    uint32_t transactions() const
+    {
+      return _statistics.transactions;
+    };
+    // simulated time on the wire at the SPI frequency set, in microseconds
+    uint32_t wireMicros() const
+    {
+      return uint32_t(_wire_ns / 1000);
+    };
+    // simulated time with BUSY active, in microseconds
+    uint32_t busyMicros() const
+    {
+      return _busy_micros;
+    };
+    // text format : "C xx" per command, "D xx xx ..." for up to 16 data bytes per line
+    std::string toText() const;
+    bool writeTo(const char* path) const;
+    // compares with a stream written by writeTo(), returns -1 if equal, else the index of the first difference
+    int32_t compareTo(const char* path) const;
+    // GxIO
+    void reset();
+    void init();
+    void setFrequency(uint32_t freq);
+    uint8_t transferTransaction(uint8_t d);
+    uint16_t transfer16Transaction(uint16_t d);
+    uint8_t readDataTransaction();
+    uint16_t readData16Transaction();
+    uint8_t readData();
+    uint16_t readData16();
+    uint32_t readRawData32(uint8_t part);
+    void writeCommandTransaction(uint8_t c);
+    void writeDataTransaction(uint8_t d);
+    void writeDataTransaction(const uint8_t* data, uint32_t n, bool invert = false);
+    void writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert = false);
+    void writeCommandData(uint8_t c, const uint8_t* data, uint32_t n);
+    void writeCommandData(uint8_t c, uint8_t d);
+    void writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n);
+    void writeData16Transaction(uint16_t d, uint32_t num = 1);
+    void writeCommand(uint8_t c);
+    void writeData(uint8_t d);
+    void writeData(uint8_t* d, uint32_t num);
+    void writeData16(uint16_t d, uint32_t num = 1);
+    void writeAddrMSBfirst(uint16_t d);
+    void startTransaction();
+    void endTransaction();
+    void selectRegister(bool rs_low) {};
+    void setBackLight(bool lit) {};
+  private:
+    static int _readBusy(void* context);
+    static bool _parse(const char* text, std::vector<Entry>& stream);
+    void _transaction();
+    void _record(bool dc, uint8_t value);
+    void _setBusy(uint32_t busy_us);
+    std::vector<Entry> _stream;
+    std::vector<uint32_t> _busy_time; // per command
+    uint32_t _reset_busy_time;
+    int8_t _busy;
+    uint8_t _busy_level;
+    uint32_t _frequency;
+    uint64_t _wire_ns;
+    uint32_t _wire_ns_pending;
+    uint32_t _busy_micros;
+    unsigned long _busy_start, _busy_end;
+};
+
+#endif
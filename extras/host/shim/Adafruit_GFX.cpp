@@ -0,0 +1,189 @@
+// host shim : minimal stand-in for Adafruit_GFX
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#include "Adafruit_GFX.h"
+
+template <typename T> static inline void
+swap(T& a, T& b)
+{
+  T t = a;
+  a = b;
+  b = t;
+}
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) :
+  WIDTH(w), HEIGHT(h), _width(w), _height(h), rotation(0), cursor_x(0), cursor_y(0),
+  textcolor(0xFFFF), textbgcolor(0xFFFF), textsize(1), wrap(true), gfxFont(0)
+{
+}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color)
+{
+  drawPixel(x, y, color);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  fillRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  drawFastVLine(x, y, h, color);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  drawFastHLine(x, y, w, color);
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep)
+  {
+    swap(x0, y0);
+    swap(x1, y1);
+  }
+  if (x0 > x1)
+  {
+    swap(x0, x1);
+    swap(y0, y1);
+  }
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++)
+  {
+    if (steep) writePixel(y0, x0, color);
+    else writePixel(x0, y0, color);
+    err -= dy;
+    if (err < 0)
+    {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Adafruit_GFX::setRotation(uint8_t r)
+{
+  rotation = (r & 3);
+  _width = (rotation & 1) ? HEIGHT : WIDTH;
+  _height = (rotation & 1) ? WIDTH : HEIGHT;
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  startWrite();
+  writeLine(x, y, x, y + h - 1, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  startWrite();
+  writeLine(x, y, x + w - 1, y, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  startWrite();
+  for (int16_t i = x; i < x + w; i++)
+  {
+    writeFastVLine(i, y, h, color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color)
+{
+  fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  if (x0 == x1)
+  {
+    if (y0 > y1) swap(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+  }
+  else if (y0 == y1)
+  {
+    if (x0 > x1) swap(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+  }
+  else
+  {
+    startWrite();
+    writeLine(x0, y0, x1, y1, color);
+    endWrite();
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+{
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++)
+  {
+    for (int16_t i = 0; i < w; i++)
+    {
+      if (i & 7) b <<= 1;
+      else b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      if (b & 0x80) writePixel(x + i, y, color);
+    }
+  }
+  endWrite();
+}
+
+// synthetic 5x8 glyph derived from the character code instead of the classic font
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size)
+{
+  startWrite();
+  for (int8_t i = 0; i < 5; i++)
+  {
+    uint8_t line = uint8_t(c * (i + 1)) | 0x41;
+    for (int8_t j = 0; j < 8; j++, line >>= 1)
+    {
+      if (line & 1) writeFillRect(x + i * size, y + j * size, size, size, color);
+      else if (bg != color) writeFillRect(x + i * size, y + j * size, size, size, bg);
+    }
+  }
+  if (bg != color) writeFillRect(x + 5 * size, y, size, 8 * size, bg);
+  endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c)
+{
+  if (c == '\n')
+  {
+    cursor_x = 0;
+    cursor_y += textsize * 8;
+  }
+  else if (c != '\r')
+  {
+    if (wrap && ((cursor_x + textsize * 6) > _width))
+    {
+      cursor_x = 0;
+      cursor_y += textsize * 8;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    cursor_x += textsize * 6;
+  }
+  return 1;
+}
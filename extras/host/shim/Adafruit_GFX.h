@@ -0,0 +1,58 @@
+// host shim : minimal stand-in for Adafruit_GFX, same virtual interface for the primitives used by GxEPD
+// text is rendered with a synthetic glyph per character, enough for layout and throughput measurement
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _ADAFRUIT_GFX_H
+#define _ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+#include "gfxfont.h"
+
+class Adafruit_GFX : public Print
+{
+  public:
+    Adafruit_GFX(int16_t w, int16_t h);
+    virtual ~Adafruit_GFX() {}
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void startWrite(void) {}
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color);
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    virtual void endWrite(void) {}
+    virtual void setRotation(uint8_t r);
+    virtual void invertDisplay(bool i) {}
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void fillScreen(uint16_t color);
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+    void setTextSize(uint8_t s) { textsize = (s > 0) ? s : 1; }
+    void setTextWrap(boolean w) { wrap = w; }
+    void setFont(const GFXfont *f = NULL) { gfxFont = (GFXfont*)f; }
+    virtual size_t write(uint8_t c);
+    int16_t width(void) const { return _width; }
+    int16_t height(void) const { return _height; }
+    uint8_t getRotation(void) const { return rotation; }
+    int16_t getCursorX(void) const { return cursor_x; }
+    int16_t getCursorY(void) const { return cursor_y; }
+  protected:
+    const int16_t WIDTH, HEIGHT;
+    int16_t _width, _height;
+    uint8_t rotation;
+    int16_t cursor_x, cursor_y;
+    uint16_t textcolor, textbgcolor;
+    uint8_t textsize;
+    boolean wrap;
+    GFXfont *gfxFont;
+};
+
+#endif
@@ -0,0 +1,76 @@
+// host shim : minimal Arduino API for compiling the GxEPD display classes on Linux
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <atomic>
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+static std::atomic<unsigned long> _host_micros(0);
+
+static const int _host_pins = 64;
+static int _host_pin_state[_host_pins];
+static int (*_host_pin_reader[_host_pins])(void*);
+static void* _host_pin_reader_context[_host_pins];
+static void (*_host_isr[_host_pins])();
+
+void pinMode(int pin, int mode)
+{
+}
+
+void digitalWrite(int pin, int value)
+{
+  if ((pin >= 0) && (pin < _host_pins)) _host_pin_state[pin] = value;
+}
+
+int digitalRead(int pin)
+{
+  if ((pin < 0) || (pin >= _host_pins)) return LOW;
+  if (_host_pin_reader[pin]) return _host_pin_reader[pin](_host_pin_reader_context[pin]);
+  return _host_pin_state[pin];
+}
+
+void attachInterrupt(int interrupt, void (*isr)(), int mode)
+{
+  if ((interrupt >= 0) && (interrupt < _host_pins)) _host_isr[interrupt] = isr;
+}
+
+void detachInterrupt(int interrupt)
+{
+  if ((interrupt >= 0) && (interrupt < _host_pins)) _host_isr[interrupt] = 0;
+}
+
+void delay(unsigned long ms)
+{
+  _host_micros += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  _host_micros += us;
+}
+
+unsigned long micros()
+{
+  return _host_micros;
+}
+
+unsigned long millis()
+{
+  return _host_micros / 1000;
+}
+
+void hostAdvanceMicros(unsigned long us)
+{
+  _host_micros += us;
+}
+
+void hostAttachPinReader(int pin, int (*reader)(void*), void* context)
+{
+  if ((pin < 0) || (pin >= _host_pins)) return;
+  _host_pin_reader[pin] = reader;
+  _host_pin_reader_context[pin] = context;
+}
@@ -0,0 +1,126 @@
+// host shim : minimal Arduino API for compiling the GxEPD display classes on Linux
+//
+// time is simulated : delay() and delayMicroseconds() advance a virtual clock, micros() and millis() read it,
+// so refresh waits cost no real time and the simulated duration of an operation can be measured.
+// pin inputs can be provided by device models, e.g. the BUSY line by GxIO_Record.
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define MISO 12
+#define HEX 16
+#define DEC 10
+#define CHANGE 1
+#define NOT_AN_INTERRUPT -1
+#define digitalPinToInterrupt(p) (p)
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_pointer(addr) (*(void* const*)(addr))
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long micros();
+unsigned long millis();
+inline void yield() {}
+// interrupts are not simulated, the ISR is kept but not called
+void attachInterrupt(int interrupt, void (*isr)(), int mode);
+void detachInterrupt(int interrupt);
+
+// host only : advance the virtual clock, e.g. for simulated transfer time
+void hostAdvanceMicros(unsigned long us);
+// host only : digitalRead(pin) returns reader(context) while attached, reader 0 detaches
+void hostAttachPinReader(int pin, int (*reader)(void*), void* context);
+
+class String : public std::string
+{
+  public:
+    String(const char* s = "") : std::string(s) {}
+    String(const std::string& s) : std::string(s) {}
+    String(int value, int base = DEC)
+    {
+      char b[16];
+      snprintf(b, sizeof(b), base == HEX ? "%x" : "%d", value);
+      assign(b);
+    }
+};
+
+class Print
+{
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    size_t print(const char* s)
+    {
+      size_t n = 0;
+      while (*s) n += write(*s++);
+      return n;
+    }
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t print(char c) { return write(c); }
+    size_t print(long value, int base = DEC)
+    {
+      char b[24];
+      snprintf(b, sizeof(b), base == HEX ? "%lx" : "%ld", value);
+      return print(b);
+    }
+    size_t print(unsigned long value, int base = DEC)
+    {
+      char b[24];
+      snprintf(b, sizeof(b), base == HEX ? "%lx" : "%lu", value);
+      return print(b);
+    }
+    size_t print(int value, int base = DEC) { return print(long(value), base); }
+    size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(double value, int digits = 2)
+    {
+      char b[32];
+      snprintf(b, sizeof(b), "%.*f", digits, value);
+      return print(b);
+    }
+    size_t println() { return write('\n'); }
+    template <typename T> size_t println(T value)
+    {
+      size_t n = print(value);
+      return n + println();
+    }
+    template <typename T> size_t println(T value, int format)
+    {
+      size_t n = print(value, format);
+      return n + println();
+    }
+};
+
+// diagnostic output goes to stderr
+class HardwareSerial : public Print
+{
+  public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) { return fputc(c, stderr) != EOF; }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,46 @@
+// host shim : minimal Arduino SPI API, transferred bytes can be observed through onTransfer
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _HOST_SPI_H_
+#define _HOST_SPI_H_
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0
+
+class SPISettings
+{
+  public:
+    SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) : _clock(clock) {}
+    uint32_t _clock;
+};
+
+class SPIClass
+{
+  public:
+    SPIClass() : onTransfer(0), onTransferContext(0) {}
+    void begin() {}
+    void end() {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t d)
+    {
+      if (onTransfer) onTransfer(onTransferContext, d);
+      return 0xFF;
+    }
+    uint16_t transfer16(uint16_t d)
+    {
+      transfer(d >> 8);
+      transfer(d & 0xFF);
+      return 0xFFFF;
+    }
+    void (*onTransfer)(void* context, uint8_t d);
+    void* onTransferContext;
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,2 @@
+// host shim : PROGMEM access is defined in Arduino.h
+#include <Arduino.h>
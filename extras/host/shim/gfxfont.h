@@ -0,0 +1,8 @@
+// host shim : GFXfont types as in Adafruit_GFX
+
+#ifndef _GFXFONT_H_
+#define _GFXFONT_H_
+#include <stdint.h>
+typedef struct { uint16_t bitmapOffset; uint8_t width, height, xAdvance; int8_t xOffset, yOffset; } GFXglyph;
+typedef struct { uint8_t* bitmap; GFXglyph* glyph; uint8_t first, last, yAdvance; } GFXfont;
+#endif
@@ -34,44 +34,7 @@ GxDEPG0266BN::GxDEPG0266BN(GxIO& io, int8_t rst, int8_t busy) :
   _current_page(-1), _using_partial_mode(false), _diag_enabled(false), _power_is_on(false),
   _rst(rst), _busy(busy)
 {
-}
-
-void GxDEPG0266BN::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxDEPG0266BN_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxDEPG0266BN_WIDTH - x - 1;
-      y = GxDEPG0266BN_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxDEPG0266BN_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxDEPG0266BN_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxDEPG0266BN_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxDEPG0266BN_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxDEPG0266BN_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxDEPG0266BN_WIDTH / 8, GxDEPG0266BN_PAGE_HEIGHT, &_current_page);
 }
 
 void GxDEPG0266BN::init(uint32_t serial_diag_bitrate)
@@ -81,8 +44,9 @@ void GxDEPG0266BN::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_SSD168x);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -101,33 +65,19 @@ void GxDEPG0266BN::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxDEPG0266BN::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (uint16_t y = 0; y < GxDEPG0266BN_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxDEPG0266BN_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxDEPG0266BN_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxDEPG0266BN_HEIGHT * (GxDEPG0266BN_WIDTH / 8), true);
   _writeCommand(0x26); // both buffers same for full b/w
-  for (uint16_t y = 0; y < GxDEPG0266BN_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxDEPG0266BN_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxDEPG0266BN_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxDEPG0266BN_HEIGHT * (GxDEPG0266BN_WIDTH / 8), true);
   _Update_Full();
   _PowerOff();
 }
@@ -140,6 +90,7 @@ void  GxDEPG0266BN::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxDEPG0266BN::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
   // bm_flip_x for normal display (bm_flip_y would be rotated)
@@ -153,37 +104,43 @@ void GxDEPG0266BN::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = true; // remember
     _Init_Part(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _Update_Part();
     delay(GxDEPG0266BN_PU_DELAY);
     // update previous buffer
     _writeCommand(0x26);
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     delay(GxDEPG0266BN_PU_DELAY);
   }
@@ -192,34 +149,40 @@ void GxDEPG0266BN::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _Init_Full(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x26); // both buffers same for full b/w
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _Update_Full();
   }
@@ -227,24 +190,19 @@ void GxDEPG0266BN::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
 
 void GxDEPG0266BN::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
     _Init_Part(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxDEPG0266BN_BUFFER_SIZE);
     _Update_Part();
     delay(GxDEPG0266BN_PU_DELAY);
     // update previous buffer
     _writeCommand(0x26);
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxDEPG0266BN_BUFFER_SIZE);
     delay(GxDEPG0266BN_PU_DELAY);
   }
   else
@@ -252,15 +210,9 @@ void GxDEPG0266BN::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _Init_Full(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxDEPG0266BN_BUFFER_SIZE);
     _writeCommand(0x26); // both buffers same for full b/w
-    for (uint32_t i = 0; i < GxDEPG0266BN_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxDEPG0266BN_BUFFER_SIZE);
     _Update_Full();
     _PowerOff();
   }
@@ -268,6 +220,7 @@ void GxDEPG0266BN::eraseDisplay(bool using_partial_update)
 
 void GxDEPG0266BN::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxDEPG0266BN_WIDTH) return;
@@ -283,12 +236,7 @@ void GxDEPG0266BN::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x24);
   for (uint16_t y1 = y; y1 <= ye; y1++)
   {
-    for (uint16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxDEPG0266BN_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxDEPG0266BN_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   _Update_Part();
   delay(GxDEPG0266BN_PU_DELAY);
@@ -299,12 +247,7 @@ void GxDEPG0266BN::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x26);
   for (uint16_t y1 = y; y1 <= ye; y1++)
   {
-    for (uint16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxDEPG0266BN_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxDEPG0266BN_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   delay(GxDEPG0266BN_PU_DELAY);
 }
@@ -333,17 +276,13 @@ void GxDEPG0266BN::_writeToWindow(uint8_t command, uint16_t xs, uint16_t ys, uin
   _writeCommand(command);
   for (uint16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (uint16_t x1 = xs / 8; x1 <= xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxDEPG0266BN_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxDEPG0266BN_WIDTH / 8) + xs / 8, xse_d8 - xs / 8 + 1, true);
   }
 }
 
 void GxDEPG0266BN::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -385,6 +324,18 @@ void GxDEPG0266BN::powerDown()
   _PowerOff();
 }
 
+bool GxDEPG0266BN::verifySPIFrequency()
+{
+  const uint8_t pattern[] = {0x55, 0xAA, 0x33, 0xCC, 0x0F, 0xF0, 0x00, 0xFF};
+  _InitDisplay(0x03); // x increase, y increase : normal mode
+  _writeCommandData(0x24, pattern, sizeof(pattern)); // start of b/w RAM
+  _SetRamPointer(0x00, 0x00, 0x00);
+  if ((_busy >= 0) && digitalRead(_busy)) _waitWhileBusy("verifySPIFrequency", 100);
+  bool ok = verifyRamReadback(IO, pattern, sizeof(pattern));
+  if (_diag_enabled && !ok) Serial.println("verifySPIFrequency failed, SPI clock set to 4MHz");
+  return ok;
+}
+
 void GxDEPG0266BN::_writeCommand(uint8_t command)
 {
   if ((_busy >= 0) && digitalRead(_busy))
@@ -401,34 +352,49 @@ void GxDEPG0266BN::_writeData(uint8_t data)
 }
 
 void GxDEPG0266BN::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen)
+{
+  _writeCommandData(pCommandData[0], pCommandData + 1, datalen - 1); // command is first byte
+}
+
+void GxDEPG0266BN::_writeCommandData(uint8_t command, const uint8_t* data, uint16_t n)
 {
   if ((_busy >= 0) && digitalRead(_busy))
   {
-    String str = String("command 0x") + String(pCommandData[0], HEX);
+    String str = String("command 0x") + String(command, HEX);
     _waitWhileBusy(str.c_str(), 100); // needed?
   }
-  IO.startTransaction();
-  IO.writeCommand(*pCommandData++);
-  for (uint8_t i = 0; i < datalen - 1; i++)  // sub the command
+  IO.writeCommandData(command, data, n);
+}
+
+void GxDEPG0266BN::_writeCommandData(uint8_t command, uint8_t data)
+{
+  _writeCommandData(command, &data, 1);
+}
+
+void GxDEPG0266BN::_writeCommandDataPGM(uint8_t command, const uint8_t* data, uint16_t n)
+{
+  if ((_busy >= 0) && digitalRead(_busy))
   {
-    IO.writeData(*pCommandData++);
+    String str = String("command 0x") + String(command, HEX);
+    _waitWhileBusy(str.c_str(), 100); // needed?
   }
-  IO.endTransaction();
-
+  IO.writeCommandDataPGM(command, data, n);
 }
 
-void GxDEPG0266BN::_waitWhileBusy(const char* comment, uint16_t busy_time)
+void GxDEPG0266BN::_waitWhileBusy(const char* comment, uint16_t busy_time, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   if (_busy >= 0)
   {
     unsigned long start = micros();
     while (1)
     {
       if (!digitalRead(_busy)) break;
-      delay(1);
+      busyIdle();
       if (micros() - start > 10000000)
       {
         if (_diag_enabled) Serial.println("Busy Timeout!");
+        onBusyTimeout();
         break;
       }
     }
@@ -447,6 +413,7 @@ void GxDEPG0266BN::_waitWhileBusy(const char* comment, uint16_t busy_time)
     (void) start;
   }
   else delay(busy_time);
+  onBusyWaitDone();
 }
 
 void GxDEPG0266BN::_setRamDataEntryMode(uint8_t em)
@@ -454,8 +421,7 @@ void GxDEPG0266BN::_setRamDataEntryMode(uint8_t em)
   const uint16_t xPixelsPar = GxDEPG0266BN_X_PIXELS - 1;
   const uint16_t yPixelsPar = GxDEPG0266BN_Y_PIXELS - 1;
   em = gx_uint16_min(em, 0x03);
-  _writeCommand(0x11);
-  _writeData(em);
+  _writeCommandData(0x11, em);
   switch (em)
   {
     case 0x00: // x decrease, y decrease
@@ -479,33 +445,32 @@ void GxDEPG0266BN::_setRamDataEntryMode(uint8_t em)
 
 void GxDEPG0266BN::_SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1)
 {
-  _writeCommand(0x44);
-  _writeData(Xstart);
-  _writeData(Xend);
-  _writeCommand(0x45);
-  _writeData(Ystart);
-  _writeData(Ystart1);
-  _writeData(Yend);
-  _writeData(Yend1);
+  {
+    const uint8_t data[] = {Xstart, Xend};
+    _writeCommandData(0x44, data, sizeof(data));
+  }
+  {
+    const uint8_t data[] = {Ystart, Ystart1, Yend, Yend1};
+    _writeCommandData(0x45, data, sizeof(data));
+  }
 }
 
 void GxDEPG0266BN::_SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1)
 {
-  _writeCommand(0x4e);
-  _writeData(addrX);
-  _writeCommand(0x4f);
-  _writeData(addrY);
-  _writeData(addrY1);
+  _writeCommandData(0x4e, addrX);
+  {
+    const uint8_t data[] = {addrY, addrY1};
+    _writeCommandData(0x4f, data, sizeof(data));
+  }
 }
 
 void GxDEPG0266BN::_PowerOn(void)
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc0);
+    _writeCommandData(0x22, 0xc0);
     _writeCommand(0x20);
-    _waitWhileBusy("_PowerOn", power_on_time);
+    _waitWhileBusy("_PowerOn", power_on_time, wait_power_on);
     _power_is_on = true;
   }
 }
@@ -514,10 +479,9 @@ void GxDEPG0266BN::_PowerOff(void)
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0x83);
+    _writeCommandData(0x22, 0x83);
     _writeCommand(0x20);
-    _waitWhileBusy("_PowerOff", power_off_time);
+    _waitWhileBusy("_PowerOff", power_off_time, wait_power_off);
     _power_is_on = false;
   }
 }
@@ -525,18 +489,17 @@ void GxDEPG0266BN::_PowerOff(void)
 void GxDEPG0266BN::_InitDisplay(uint8_t em)
 {
   _writeCommand(0x12);  //SWRESET
-  delay(10); // 10ms according to specs
-  _writeCommand(0x01); //Driver output control
-  _writeData(0x27);
-  _writeData(0x01);
-  _writeData(0x00);
-  _writeCommand(0x3C); //BorderWavefrom
-  _writeData(0x05);
-  _writeCommand(0x21); //  Display update control
-  _writeData(0x00);
-  _writeData(0x80);
-  _writeCommand(0x18); //Read built-in temperature sensor
-  _writeData(0x80);
+  GxIO::waitReady(_busy, HIGH, 10); // 10ms according to specs, less if BUSY reports ready
+  {
+    const uint8_t data[] = {0x27, 0x01, 0x00};
+    _writeCommandData(0x01, data, sizeof(data)); //Driver output control
+  }
+  _writeCommandData(0x3C, 0x05); // BorderWavefrom
+  {
+    const uint8_t data[] = {0x00, 0x80};
+    _writeCommandData(0x21, data, sizeof(data)); //  Display update control
+  }
+  _writeCommandData(0x18, 0x80); // Read built-in temperature sensor
   _setRamDataEntryMode(em);
 }
 
@@ -571,28 +534,22 @@ const unsigned char GxDEPG0266BN::lut_partial[] PROGMEM =
 void GxDEPG0266BN::_Init_Part(uint8_t em)
 {
   _InitDisplay(em);
-  _writeCommand(0x32);
-  for (uint16_t i = 0; i < sizeof(lut_partial); i++)
-  {
-    _writeData(pgm_read_byte(&lut_partial[i]));
-  }
+  _writeCommandDataPGM(0x32, lut_partial, sizeof(lut_partial));
   _PowerOn();
 }
 
 void GxDEPG0266BN::_Update_Full(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xf7); // disable analog (powerOff() here)
+  _writeCommandData(0x22, 0xf7); // disable analog (powerOff() here)
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Full", full_refresh_time);
+  _waitWhileBusy("_Update_Full", full_refresh_time, wait_full_refresh);
 }
 
 void GxDEPG0266BN::_Update_Part(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xcc);
+  _writeCommandData(0x22, 0xcc);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Part", partial_refresh_time);
+  _waitWhileBusy("_Update_Part", partial_refresh_time, wait_partial_refresh);
 }
 
 void GxDEPG0266BN::drawPaged(void (*drawCallback)(void))
@@ -606,16 +563,8 @@ void GxDEPG0266BN::drawPaged(void (*drawCallback)(void))
     for (_current_page = 0; _current_page < GxDEPG0266BN_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      for (int16_t y1 = 0; y1 < GxDEPG0266BN_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxDEPG0266BN_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxDEPG0266BN_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback);
+      IO.writeDataTransactionAsync(_buffer, GxDEPG0266BN_PAGE_HEIGHT * (GxDEPG0266BN_WIDTH / 8), true);
     }
     _current_page = -1;
     if (cmd == 0x26) break;
@@ -635,16 +584,8 @@ void GxDEPG0266BN::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
     for (_current_page = 0; _current_page < GxDEPG0266BN_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxDEPG0266BN_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxDEPG0266BN_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxDEPG0266BN_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxDEPG0266BN_PAGE_HEIGHT * (GxDEPG0266BN_WIDTH / 8), true);
     }
     _current_page = -1;
     if (cmd == 0x26) break;
@@ -664,16 +605,8 @@ void GxDEPG0266BN::drawPaged(void (*drawCallback)(const void*), const void* p)
     for (_current_page = 0; _current_page < GxDEPG0266BN_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxDEPG0266BN_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxDEPG0266BN_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxDEPG0266BN_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxDEPG0266BN_PAGE_HEIGHT * (GxDEPG0266BN_WIDTH / 8), true);
     }
     _current_page = -1;
     if (cmd == 0x26) break;
@@ -693,16 +626,8 @@ void GxDEPG0266BN::drawPaged(void (*drawCallback)(const void*, const void*), con
     for (_current_page = 0; _current_page < GxDEPG0266BN_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      for (int16_t y1 = 0; y1 < GxDEPG0266BN_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxDEPG0266BN_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxDEPG0266BN_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p1, p2);
+      IO.writeDataTransactionAsync(_buffer, GxDEPG0266BN_PAGE_HEIGHT * (GxDEPG0266BN_WIDTH / 8), true);
     }
     _current_page = -1;
     if (cmd == 0x26) break;
@@ -750,7 +675,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x24, x, ys, x, yds, w, yde - yds);
     }
@@ -765,7 +690,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x26, x, ys, x, yds, w, yde - yds);
     }
@@ -792,7 +717,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x24, x, ys, x, yds, w, yde - yds);
     }
@@ -807,7 +732,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x26, x, ys, x, yds, w, yde - yds);
     }
@@ -834,7 +759,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x24, x, ys, x, yds, w, yde - yds);
     }
@@ -849,7 +774,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x26, x, ys, x, yds, w, yde - yds);
     }
@@ -876,7 +801,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x24, x, ys, x, yds, w, yde - yds);
     }
@@ -891,7 +816,7 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxDEPG0266BN_PAGE_HEIGHT;
       _writeToWindow(0x26, x, ys, x, yds, w, yde - yds);
     }
@@ -902,19 +827,23 @@ void GxDEPG0266BN::drawPagedToWindow(void (*drawCallback)(const void*, const voi
 
 void GxDEPG0266BN::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _Init_Full(em);
   _writeCommand(0x24);
-  for (uint32_t y = 0; y < GxDEPG0266BN_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxDEPG0266BN_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxDEPG0266BN_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxDEPG0266BN_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxDEPG0266BN_WIDTH / 8 - 4) && (y > GxDEPG0266BN_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxDEPG0266BN_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxDEPG0266BN_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxDEPG0266BN_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxDEPG0266BN_WIDTH / 8 - 4) && (y > GxDEPG0266BN_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxDEPG0266BN_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _Update_Full();
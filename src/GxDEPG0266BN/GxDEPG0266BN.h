@@ -44,7 +44,6 @@ class GxDEPG0266BN : public GxEPD
 #else
     GxDEPG0266BN(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -59,6 +58,8 @@ class GxDEPG0266BN : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
+    // needs MISO connected to DIN, see GxEPD.h
+    bool verifySPIFrequency();
     // paged drawing, for limited RAM, drawCallback() is called GxDEPG0266BN_PAGES times
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
@@ -81,13 +82,16 @@ class GxDEPG0266BN : public GxEPD
     }
     void _writeToWindow(uint8_t command, uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h);
     void _writeData(uint8_t data);
+    void _writeCommandData(uint8_t command, const uint8_t* data, uint16_t n);
+    void _writeCommandData(uint8_t command, uint8_t data);
+    void _writeCommandDataPGM(uint8_t command, const uint8_t* data, uint16_t n);
     void _writeCommand(uint8_t command);
     void _writeCommandData(const uint8_t* pCommandData, uint8_t datalen);
     void _SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1);
     void _SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1);
     void _PowerOn(void);
     void _PowerOff(void);
-    void _waitWhileBusy(const char* comment, uint16_t busy_time);
+    void _waitWhileBusy(const char* comment, uint16_t busy_time, busy_wait wait = wait_other);
     void _setRamDataEntryMode(uint8_t em);
     void _InitDisplay(uint8_t em);
     void _Init_Full(uint8_t em);
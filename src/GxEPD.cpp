@@ -18,11 +18,67 @@
 #include <avr/pgmspace.h>
 #endif
 
+void (*GxEPD::_refresh_wait_hook)(void*) = 0;
+void* GxEPD::_refresh_wait_hook_p = 0;
+void (*GxEPD::_busy_idle_callback)(int8_t, void*) = 0;
+void* GxEPD::_busy_idle_callback_p = 0;
+volatile bool GxEPD::_busy_edge = false;
+
+#if defined(ESP8266) || defined(ESP32)
+#define GxEPD_ISR_ATTR IRAM_ATTR
+#else
+#define GxEPD_ISR_ATTR
+#endif
+
+static inline uint8_t bitmapByte(const uint8_t* p)
+{
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+  return pgm_read_byte(p);
+#else
+  return *p;
+#endif
+}
+
+// target of bitmap pixel i, j : quarter turns clockwise of bm_r90, bm_r180, then flips
+static inline void bitmapTarget(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t i, uint16_t j, int16_t mode, uint16_t& xd, uint16_t& yd)
+{
+  uint16_t u = i, v = j;
+  switch (mode & GxEPD::bm_r270)
+  {
+    case GxEPD::bm_r90:
+      u = h - 1 - j;
+      v = i;
+      break;
+    case GxEPD::bm_r180:
+      u = w - 1 - i;
+      v = h - 1 - j;
+      break;
+    case GxEPD::bm_r270:
+      u = j;
+      v = w - 1 - i;
+      break;
+  }
+  if (mode & GxEPD::bm_flip_x) u = ((mode & GxEPD::bm_r90) ? h : w) - u;
+  if (mode & GxEPD::bm_flip_y) v = ((mode & GxEPD::bm_r90) ? w : h) - v;
+  xd = x + u;
+  yd = y + v;
+}
+
 void  GxEPD::drawBitmapBM(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
 {
   uint16_t inverse_color = (color != GxEPD_WHITE) ? GxEPD_WHITE : GxEPD_BLACK;
   uint16_t fg_color = (mode & bm_invert) ? inverse_color : color;
   uint16_t bg_color = (mode & bm_invert) ? color : inverse_color;
+  if (_buffer_colors != buffer_none)
+  {
+    // culled if not on the clip rectangle, one more column and row for flips, see bitmapTarget()
+    int32_t lw = (mode & bm_r90) ? h : w;
+    int32_t lh = (mode & bm_r90) ? w : h;
+    _checkClip();
+    int16_t sx = x, sy = y; // as passed, e.g. negative
+    if ((sx > _clip_x1) || (sy > _clip_y1) || (sx + lw < _clip_x0) || (sy + lh < _clip_y0)) return;
+  }
+  if (blitBitmap(bitmap, x, y, w, h, (mode & bm_transparent) ? color : fg_color, bg_color, mode)) return;
   // taken from Adafruit_GFX.cpp, modified
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
@@ -45,10 +101,8 @@ void  GxEPD::drawBitmapBM(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_
         if (bool(mode & bm_invert) != bool(byte & 0x80))
         //if (!(byte & 0x80))
         {
-          uint16_t xd = x + i;
-          uint16_t yd = y + j;
-          if (mode & bm_flip_x) xd = x + w - i;
-          if (mode & bm_flip_y) yd = y + h - j;
+          uint16_t xd, yd;
+          bitmapTarget(x, y, w, h, i, j, mode, xd, yd);
           drawPixel(xd, yd, color);
         }
       }
@@ -71,12 +125,1175 @@ void  GxEPD::drawBitmapBM(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_
         }
         // keep using overwrite mode
         uint16_t pixelcolor = (byte & 0x80) ? fg_color  : bg_color;
-        uint16_t xd = x + i;
-        uint16_t yd = y + j;
-        if (mode & bm_flip_x) xd = x + w - i;
-        if (mode & bm_flip_y) yd = y + h - j;
+        uint16_t xd, yd;
+        bitmapTarget(x, y, w, h, i, j, mode, xd, yd);
         drawPixel(xd, yd, pixelcolor);
       }
     }
   }
 }
+
+// reverses the bit order of a byte
+static inline uint8_t reverseBits(uint8_t b)
+{
+  b = (b >> 4) | (b << 4);
+  b = ((b & 0xCC) >> 2) | ((b & 0x33) << 2);
+  return ((b & 0xAA) >> 1) | ((b & 0x55) << 1);
+}
+
+// transposes an 8x8 bit matrix, rows of 8 bits MSB first, bit 7 - c of row r to bit 7 - r of row c
+// (Hacker's Delight, transpose8)
+static void transposeBits(uint8_t* b)
+{
+  uint32_t x = (uint32_t(b[0]) << 24) | (uint32_t(b[1]) << 16) | (uint32_t(b[2]) << 8) | b[3];
+  uint32_t y = (uint32_t(b[4]) << 24) | (uint32_t(b[5]) << 16) | (uint32_t(b[6]) << 8) | b[7];
+  uint32_t t;
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+  b[0] = x >> 24; b[1] = x >> 16; b[2] = x >> 8; b[3] = x;
+  b[4] = y >> 24; b[5] = y >> 16; b[6] = y >> 8; b[7] = y;
+}
+
+// byte k of target row v of a bitmap for 0 or 2 quarter turns, 0 outside of the bitmap
+static uint8_t bitmapRowByte(const uint8_t* bitmap, int16_t byte_width, uint16_t w, uint16_t h, uint8_t turns, int16_t v, int16_t k)
+{
+  if (turns == 0) return ((k >= 0) && (k < byte_width)) ? bitmapByte(bitmap + uint32_t(v) * byte_width + k) : 0;
+  // half turn : bitmap row h - 1 - v from its end, bit reversed, shifted by the padding bits of the row
+  const uint8_t* row = bitmap + uint32_t(h - 1 - v) * byte_width;
+  uint8_t pad = 8 * byte_width - w;
+  uint8_t b = ((k >= 0) && (k < byte_width)) ? reverseBits(bitmapByte(row + byte_width - 1 - k)) : 0;
+  if (!pad) return b;
+  k++;
+  uint8_t n = ((k >= 0) && (k < byte_width)) ? reverseBits(bitmapByte(row + byte_width - 1 - k)) : 0;
+  return (b << pad) | (n >> (8 - pad));
+}
+
+// 8 target rows from byte column m of a bitmap, target byte k of each, for 1 or 3 quarter turns
+static void bitmapBlock(const uint8_t* bitmap, int16_t byte_width, uint16_t h, uint8_t turns, int16_t m, int16_t k, uint8_t* block)
+{
+  for (uint8_t c = 0; c < 8; c++)
+  {
+    // bitmap row of target column 8 * k + c
+    int16_t j = (turns == 1) ? h - 1 - 8 * k - c : 8 * k + c;
+    uint8_t b = ((j >= 0) && (j < int16_t(h))) ? bitmapByte(bitmap + uint32_t(j) * byte_width + m) : 0;
+    block[c] = (turns == 1) ? b : reverseBits(b);
+  }
+  transposeBits(block);
+}
+
+static inline uint32_t load32(const uint8_t* p)
+{
+  uint32_t v;
+  memcpy(&v, p, 4); // no alignment needed
+  return v;
+}
+
+// first and last differing byte of n bytes, compared 32 bits at a time, false if equal
+static bool diffSpan(const uint8_t* a, const uint8_t* b, uint16_t n, uint16_t& first, uint16_t& last)
+{
+  uint16_t i = 0;
+  while ((i + 4 <= n) && (load32(a + i) == load32(b + i))) i += 4;
+  while ((i < n) && (a[i] == b[i])) i++;
+  if (i == n) return false;
+  uint16_t j = n;
+  while ((j >= i + 4) && (load32(a + j - 4) == load32(b + j - 4))) j -= 4;
+  while (a[j - 1] == b[j - 1]) j--;
+  first = i;
+  last = j - 1;
+  return true;
+}
+
+inline void GxEPD::_blitByte(const blit_planes& planes, uint32_t i, uint8_t bits, uint8_t mask)
+{
+  if (planes.transparent)
+  {
+    mask &= bits ^ planes.invert;
+    _buffer_black[i] = (_buffer_black[i] & ~mask) | (planes.fg_black & mask);
+    if (_buffer_red) _buffer_red[i] = (_buffer_red[i] & ~mask) | (planes.fg_red & mask);
+  }
+  else
+  {
+    _buffer_black[i] = (_buffer_black[i] & ~mask) | (((bits & planes.fg_black) | (~bits & planes.bg_black)) & mask);
+    if (_buffer_red) _buffer_red[i] = (_buffer_red[i] & ~mask) | (((bits & planes.fg_red) | (~bits & planes.bg_red)) & mask);
+  }
+}
+
+bool GxEPD::blitBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t fg_color, uint16_t bg_color, int16_t mode)
+{
+  if ((_buffer_colors == buffer_none) || (mode & (bm_flip_x | bm_flip_y))) return false;
+  if (_buffer_held) _releaseBuffer();
+  if (_isRecording())
+  {
+    list_bitmap b = {bitmap, x, y, w, h, fg_color, bg_color, mode};
+    _recordOp(list_op_bitmap, &b, sizeof(b));
+  }
+  // quarter turns clockwise from bitmap to buffer, bitmap mode and display rotation
+  uint8_t turns = (getRotation() + ((mode & bm_r90) ? 1 : 0) + ((mode & bm_r180) ? 2 : 0)) & 3;
+  // target rectangle, in buffer orientation, not clipped
+  int32_t lw = (mode & bm_r90) ? h : w;
+  int32_t lh = (mode & bm_r90) ? w : h;
+  // x and y as passed as int16_t, e.g. negative
+  int32_t sx = int16_t(x), sy = int16_t(y);
+  int32_t px = sx, py = sy, pw = lw, ph = lh;
+  switch (getRotation())
+  {
+    case 1:
+      px = int32_t(WIDTH) - sy - lh;
+      py = sx;
+      pw = lh;
+      ph = lw;
+      break;
+    case 2:
+      px = int32_t(WIDTH) - sx - lw;
+      py = int32_t(HEIGHT) - sy - lh;
+      break;
+    case 3:
+      px = sy;
+      py = int32_t(HEIGHT) - sx - lw;
+      pw = lh;
+      ph = lw;
+      break;
+  }
+  // visible columns and rows, clipped to the screen and to the current page
+  int32_t page_y = 0;
+  int32_t rows = _buffer_rows;
+  if (*_buffer_page >= 0)
+  {
+    page_y = int32_t(*_buffer_page) * _buffer_page_height;
+    rows = _buffer_page_height;
+  }
+  int32_t x0 = (px > 0) ? px : 0;
+  int32_t x1 = px + pw - 1;
+  int32_t y0 = (py > page_y) ? py : page_y;
+  int32_t y1 = py + ph - 1;
+  if (x1 >= WIDTH) x1 = WIDTH - 1;
+  if (y1 >= HEIGHT) y1 = HEIGHT - 1;
+  if (y1 >= page_y + rows) y1 = page_y + rows - 1;
+  if ((x0 > x1) || (y0 > y1)) return true;
+  markDirty(x0, y0, x1, y1);
+  // bits of the planes for foreground (source bit set) and background
+  bool black, red;
+  bool red_inverted = (_buffer_colors == buffer_3c_red_inverted);
+  blit_planes planes;
+  bufferColorBits(fg_color, black, red);
+  planes.fg_black = black ? 0xFF : 0x00;
+  planes.fg_red = (red != red_inverted) ? 0xFF : 0x00;
+  bufferColorBits(bg_color, black, red);
+  planes.bg_black = black ? 0xFF : 0x00;
+  planes.bg_red = (red != red_inverted) ? 0xFF : 0x00;
+  planes.transparent = (mode & bm_transparent);
+  planes.invert = (mode & bm_invert) ? 0xFF : 0x00;
+  int16_t byte_width = (w + 7) / 8;
+  // bitmap bytes k of the target rows are shifted into buffer bytes through 16 bit windows, shift 0 for byte aligned px
+  uint8_t shift = px & 7;
+  int32_t k_offset = (px - shift) / 8; // k = buffer byte index - k_offset
+  int16_t first = x0 >> 3;
+  int16_t last = x1 >> 3;
+  uint8_t first_mask = 0xFF >> (x0 & 7);
+  uint8_t last_mask = 0xFF << (7 - (x1 & 7));
+  if (!(turns & 1))
+  {
+    // target rows are bitmap rows, reversed for half turn
+    for (int32_t yy = y0; yy <= y1; yy++)
+    {
+      uint32_t offset = uint32_t(yy - page_y) * _buffer_row_bytes;
+      int16_t v = yy - py;
+      int16_t k = first - k_offset;
+      uint16_t window = bitmapRowByte(bitmap, byte_width, w, h, turns, v, k - 1);
+      for (int16_t i = first; i <= last; i++, k++)
+      {
+        window = (window << 8) | bitmapRowByte(bitmap, byte_width, w, h, turns, v, k);
+        uint8_t mask = 0xFF;
+        if (i == first) mask &= first_mask;
+        if (i == last) mask &= last_mask;
+        _blitByte(planes, offset + i, window >> shift, mask);
+      }
+    }
+    return true;
+  }
+  // target rows are bitmap columns, 8 target rows from each byte column of the bitmap, through 8x8 transposes
+  int16_t v0 = y0 - py;
+  int16_t v1 = y1 - py;
+  int16_t m0 = (turns == 1) ? v0 / 8 : (w - 1 - v1) / 8;
+  int16_t m1 = (turns == 1) ? v1 / 8 : (w - 1 - v0) / 8;
+  for (int16_t m = m0; m <= m1; m++)
+  {
+    // target row of bit 7 of the bytes in byte column m, the rows of the block follow
+    int16_t v_base = (turns == 1) ? 8 * m : w - 8 - 8 * m;
+    uint16_t window[8];
+    uint8_t block[8];
+    int16_t k = first - k_offset;
+    bitmapBlock(bitmap, byte_width, h, turns, m, k - 1, block);
+    for (uint8_t r = 0; r < 8; r++) window[r] = block[r];
+    for (int16_t i = first; i <= last; i++, k++)
+    {
+      bitmapBlock(bitmap, byte_width, h, turns, m, k, block);
+      uint8_t mask = 0xFF;
+      if (i == first) mask &= first_mask;
+      if (i == last) mask &= last_mask;
+      for (uint8_t r = 0; r < 8; r++)
+      {
+        window[r] = (window[r] << 8) | block[r];
+        int16_t v = v_base + r;
+        if ((v < v0) || (v > v1)) continue;
+        _blitByte(planes, uint32_t(py + v - page_y) * _buffer_row_bytes + i, window[r] >> shift, mask);
+      }
+    }
+  }
+  return true;
+}
+
+void GxEPD::setBufferLayout(buffer_colors colors, uint8_t* black, uint8_t* red, uint32_t size, uint16_t row_bytes, uint16_t page_height, const int16_t* current_page)
+{
+  _buffer_colors = colors;
+  _buffer_black = black;
+  _buffer_red = red;
+  _buffer_size = size;
+  _buffer_row_bytes = row_bytes;
+  _buffer_page_height = page_height;
+  _buffer_page = current_page;
+  _buffer_rows = size / row_bytes;
+  _selectPixelWriter();
+  _updateClip();
+}
+
+void GxEPD::beginPages()
+{
+  uint32_t row_bytes = _buffer_red ? 2 * uint32_t(_buffer_row_bytes) : _buffer_row_bytes;
+  if (!_buffer_row_bytes || (_page_buffer_size < row_bytes)) return;
+  uint16_t page_height = gx_int32_min(_page_buffer_size / row_bytes, HEIGHT);
+  uint32_t size = uint32_t(page_height) * _buffer_row_bytes;
+  _paged_black = _buffer_black;
+  _paged_red = _buffer_red;
+  _paged_size = _buffer_size;
+  _paged_page_height = _buffer_page_height;
+  setBufferLayout(_buffer_colors, _page_buffer, _buffer_red ? _page_buffer + size : 0, size, _buffer_row_bytes, page_height, _buffer_page);
+}
+
+void GxEPD::endPages()
+{
+  if (!_paged_page_height) return;
+  setBufferLayout(_buffer_colors, _paged_black, _paged_red, _paged_size, _buffer_row_bytes, _paged_page_height, _buffer_page);
+  _paged_page_height = 0;
+}
+
+void GxEPD::fillBuffers(uint8_t black, uint8_t red)
+{
+  if (!_buffer_black) return;
+  if (_buffer_held) _releaseBuffer();
+  memset(_buffer_black, black, _buffer_size);
+  if (_buffer_red) memset(_buffer_red, red, _buffer_size);
+}
+
+void GxEPD::setRotation(uint8_t r)
+{
+  if (_isRecording()) _recordOp(list_op_rotation, &r, 1);
+  GxFont_GFX::setRotation(r);
+  _selectPixelWriter();
+  _updateClip();
+}
+
+void GxEPD::_updateClip()
+{
+  int16_t page = _buffer_page ? *_buffer_page : -1;
+  _clip_page = page;
+  _clip_x0 = 0;
+  _clip_y0 = 0;
+  _clip_x1 = _width - 1;
+  _clip_y1 = _height - 1;
+  if ((page < 0) || _isRecording()) return;
+  // rows of the page in buffer orientation, to rotated coordinates, see drawPixel()
+  int16_t b0 = page * _buffer_page_height;
+  int16_t b1 = b0 + _buffer_page_height - 1;
+  switch (getRotation())
+  {
+    case 0:
+      _clip_y0 = gx_int16_max(_clip_y0, b0);
+      _clip_y1 = gx_int16_min(_clip_y1, b1);
+      break;
+    case 1:
+      _clip_x0 = gx_int16_max(_clip_x0, b0);
+      _clip_x1 = gx_int16_min(_clip_x1, b1);
+      break;
+    case 2:
+      _clip_y0 = gx_int16_max(_clip_y0, HEIGHT - 1 - b1);
+      _clip_y1 = gx_int16_min(_clip_y1, HEIGHT - 1 - b0);
+      break;
+    case 3:
+      _clip_x0 = gx_int16_max(_clip_x0, HEIGHT - 1 - b1);
+      _clip_x1 = gx_int16_min(_clip_x1, HEIGHT - 1 - b0);
+      break;
+  }
+}
+
+void GxEPD::_selectPixelWriter()
+{
+  if (_buffer_colors == buffer_none) _pixel_writer = &GxEPD::_writeNoPixel;
+  else if (_buffer_colors == buffer_bw) switch (getRotation())
+  {
+    case 0: _pixel_writer = &GxEPD::_writeBufferPixel<0, true>; break;
+    case 1: _pixel_writer = &GxEPD::_writeBufferPixel<1, true>; break;
+    case 2: _pixel_writer = &GxEPD::_writeBufferPixel<2, true>; break;
+    case 3: _pixel_writer = &GxEPD::_writeBufferPixel<3, true>; break;
+  }
+  else switch (getRotation())
+  {
+    case 0: _pixel_writer = &GxEPD::_writeBufferPixel<0, false>; break;
+    case 1: _pixel_writer = &GxEPD::_writeBufferPixel<1, false>; break;
+    case 2: _pixel_writer = &GxEPD::_writeBufferPixel<2, false>; break;
+    case 3: _pixel_writer = &GxEPD::_writeBufferPixel<3, false>; break;
+  }
+  if (_isRecording())
+  {
+    _list->writer = _pixel_writer;
+    _pixel_writer = &GxEPD::_recordPixel;
+  }
+  if (_buffer_held) _pixel_writer = &GxEPD::_writeHeldPixel;
+}
+
+void GxEPD::holdBuffer(bool held)
+{
+  _buffer_held = held;
+  _selectPixelWriter();
+}
+
+void GxEPD::_writeHeldPixel(int16_t x, int16_t y, uint16_t color)
+{
+  _releaseBuffer();
+  drawPixel(x, y, color);
+}
+
+void GxEPD::_releaseBuffer()
+{
+  finish();
+  holdBuffer(false);
+}
+
+void GxEPD::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  (this->*_pixel_writer)(x, y, color);
+}
+
+template <uint8_t rotation, bool bw> void GxEPD::_writeBufferPixel(int16_t x, int16_t y, uint16_t color)
+{
+  // unsigned compares also reject negative coordinates
+  if ((uint16_t(x) >= uint16_t(_width)) || (uint16_t(y) >= uint16_t(_height))) return;
+  int16_t t;
+  switch (rotation) // resolved at compile time
+  {
+    case 1:
+      t = x; x = WIDTH - y - 1; y = t;
+      break;
+    case 2:
+      x = WIDTH - x - 1;
+      y = HEIGHT - y - 1;
+      break;
+    case 3:
+      t = x; x = y; y = HEIGHT - t - 1;
+      break;
+  }
+  int16_t page = *_buffer_page;
+  if (page < 0)
+  {
+    if (uint16_t(y) >= _buffer_rows) return;
+    // not _isDirtyHit(), gets not inlined with -Os
+    if (_dirty && ((uint16_t(x - _dirty->hit_x) >= _dirty->hit_w) || (uint16_t(y - _dirty->hit_y) >= _dirty->hit_h))) _addDirty(x, y, x, y);
+  }
+  else
+  {
+    y -= page * _buffer_page_height;
+    if (uint16_t(y) >= _buffer_page_height) return;
+  }
+  uint8_t* black = _buffer_black + (x >> 3) + uint32_t(y) * _buffer_row_bytes;
+  uint8_t mask = 0x80 >> (x & 7);
+  if (bw)
+  {
+    if (!color) *black |= mask;
+    else *black &= ~mask;
+    return;
+  }
+  bool set_black = (color == GxEPD_BLACK);
+  bool set_red = (color == GxEPD_RED);
+  if (!set_black && !set_red && (color != GxEPD_WHITE)) bufferColorBits(color, set_black, set_red);
+  uint8_t* red = _buffer_red + (black - _buffer_black);
+  if (set_black) *black |= mask;
+  else *black &= ~mask;
+  if (set_red != (_buffer_colors == buffer_3c_red_inverted)) *red |= mask;
+  else *red &= ~mask;
+}
+
+void GxEPD::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  if (_buffer_colors == buffer_none)
+  {
+    GxFont_GFX::writeLine(x0, y0, x1, y1, color);
+    return;
+  }
+  // same steps as Adafruit_GFX::writeLine(), pixel k at (x0 + k, y0 + ystep * n(k)), swapped if steep,
+  // with n(k) = ceil((k * dy - err) / dx), clipped to the steps k on the clip rectangle
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  int16_t t;
+  if (steep)
+  {
+    t = x0; x0 = y0; y0 = t;
+    t = x1; x1 = y1; y1 = t;
+  }
+  if (x0 > x1)
+  {
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+  int32_t dx = x1 - x0;
+  int32_t dy = abs(y1 - y0);
+  int32_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+  _checkClip();
+  int32_t k0 = gx_int32_max(0, int32_t(steep ? _clip_y0 : _clip_x0) - x0);
+  int32_t k1 = gx_int32_min(dx, int32_t(steep ? _clip_y1 : _clip_x1) - x0);
+  if (dy > 0)
+  {
+    // steps n on the clip rectangle, first k of n is (n - 1) * dx + err) / dy + 1
+    int32_t c0 = steep ? _clip_x0 : _clip_y0;
+    int32_t c1 = steep ? _clip_x1 : _clip_y1;
+    int32_t n0 = (ystep > 0) ? c0 - y0 : y0 - c1;
+    int32_t n1 = (ystep > 0) ? c1 - y0 : y0 - c0;
+    if (n0 > 0) k0 = gx_int32_max(k0, ((n0 - 1) * dx + err) / dy + 1);
+    if (n1 < 0) return;
+    k1 = gx_int32_min(k1, (n1 * dx + err) / dy);
+  }
+  else if ((y0 < (steep ? _clip_x0 : _clip_y0)) || (y0 > (steep ? _clip_x1 : _clip_y1))) return;
+  if (k0 > k1) return;
+  int32_t n = (k0 * dy > err) ? (k0 * dy - err + dx - 1) / dx : 0;
+  err += n * dx - k0 * dy;
+  x0 += k0;
+  y0 += ystep * n;
+  for (int32_t k = k0; k <= k1; k++, x0++)
+  {
+    if (steep) drawPixel(y0, x0, color);
+    else drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0)
+    {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void GxEPD::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  if (_buffer_colors == buffer_none) GxFont_GFX::drawFastVLine(x, y, h, color);
+  else fillRect(x, y, 1, h, color);
+}
+
+void GxEPD::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  if (_buffer_colors == buffer_none) GxFont_GFX::drawFastHLine(x, y, w, color);
+  else fillRect(x, y, w, 1, color);
+}
+
+void GxEPD::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (_buffer_colors == buffer_none)
+  {
+    GxFont_GFX::fillRect(x, y, w, h, color);
+    return;
+  }
+  if (_buffer_held) _releaseBuffer();
+  if (w < 0)
+  {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0)
+  {
+    y += h + 1;
+    h = -h;
+  }
+  _checkClip();
+  if (x < _clip_x0)
+  {
+    w -= _clip_x0 - x;
+    x = _clip_x0;
+  }
+  if (y < _clip_y0)
+  {
+    h -= _clip_y0 - y;
+    y = _clip_y0;
+  }
+  if (w > _clip_x1 + 1 - x) w = _clip_x1 + 1 - x;
+  if (h > _clip_y1 + 1 - y) h = _clip_y1 + 1 - y;
+  if ((w <= 0) || (h <= 0)) return;
+  if (_isRecording()) _recordRect(x, y, w, h, color);
+  // rotate to buffer orientation, same as drawPixel()
+  int16_t t;
+  switch (getRotation())
+  {
+    case 1:
+      t = x; x = WIDTH - y - h; y = t;
+      t = w; w = h; h = t;
+      break;
+    case 2:
+      x = WIDTH - x - w;
+      y = HEIGHT - y - h;
+      break;
+    case 3:
+      t = y; y = HEIGHT - x - w; x = t;
+      t = w; w = h; h = t;
+      break;
+  }
+  // clip to the current page, or to the buffer
+  int16_t rows = _buffer_rows;
+  if (*_buffer_page >= 0)
+  {
+    y -= *_buffer_page * _buffer_page_height;
+    rows = _buffer_page_height;
+  }
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if (h > rows - y) h = rows - y;
+  if (h <= 0) return;
+  markDirty(x, y, x + w - 1, y + h - 1);
+  bool black, red;
+  bufferColorBits(color, black, red);
+  fillBufferBits(_buffer_black, x, y, w, h, black);
+  if (_buffer_red) fillBufferBits(_buffer_red, x, y, w, h, red != (_buffer_colors == buffer_3c_red_inverted));
+}
+
+void GxEPD::_addDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  if (!_buffer_page || (*_buffer_page >= 0)) return; // no buffer, or transferred by drawPaged()
+  dirty_rect* d;
+  dirty_rect* dirty = _dirty->rects;
+  uint8_t& count = _dirty->count;
+  // whole bytes in x, windows of the controllers are byte aligned
+  dirty_rect r = {int16_t(x0 & ~7), y0, int16_t(x1 | 7), y1};
+  if (r.x1 >= WIDTH) r.x1 = WIDTH - 1;
+  while (true)
+  {
+    // absorb the overlapping or adjacent rectangles
+    uint8_t i = 0;
+    while (i < count)
+    {
+      d = &dirty[i];
+      if ((r.x0 <= d->x1 + 1) && (d->x0 <= r.x1 + 1) && (r.y0 <= d->y1 + 1) && (d->y0 <= r.y1 + 1))
+      {
+        r.x0 = gx_int16_min(r.x0, d->x0);
+        r.y0 = gx_int16_min(r.y0, d->y0);
+        r.x1 = gx_int16_max(r.x1, d->x1);
+        r.y1 = gx_int16_max(r.y1, d->y1);
+        *d = dirty[--count];
+        i = 0;
+      }
+      else i++;
+    }
+    if (count < GxEPD_DIRTY_RECTS) break;
+    // list full : merge with the rectangle that grows least in area
+    uint8_t best = 0;
+    uint32_t best_growth = 0xFFFFFFFF;
+    for (i = 0; i < count; i++)
+    {
+      d = &dirty[i];
+      uint32_t w = gx_int16_max(r.x1, d->x1) - gx_int16_min(r.x0, d->x0) + 1;
+      uint32_t h = gx_int16_max(r.y1, d->y1) - gx_int16_min(r.y0, d->y0) + 1;
+      uint32_t growth = w * h - uint32_t(d->x1 - d->x0 + 1) * (d->y1 - d->y0 + 1);
+      if (growth < best_growth)
+      {
+        best = i;
+        best_growth = growth;
+      }
+    }
+    d = &dirty[best];
+    r.x0 = gx_int16_min(r.x0, d->x0);
+    r.y0 = gx_int16_min(r.y0, d->y0);
+    r.x1 = gx_int16_max(r.x1, d->x1);
+    r.y1 = gx_int16_max(r.y1, d->y1);
+    *d = dirty[--count];
+  }
+  dirty[count++] = r;
+  _dirty->hit_x = r.x0;
+  _dirty->hit_y = r.y0;
+  _dirty->hit_w = r.x1 - r.x0 + 1;
+  _dirty->hit_h = r.y1 - r.y0 + 1;
+}
+
+void GxEPD::updateDirty()
+{
+  if ((_buffer_colors == buffer_none) || !_dirty || (_dirty->count && !hasUpdateWindow()))
+  {
+    clearDirty();
+    update();
+    return;
+  }
+  if (!_dirty->count) return;
+  // each window is a refresh of its own, the refresh time dominates : one window around all regions
+  dirty_rect r = _dirty->rects[0];
+  for (uint8_t i = 1; i < _dirty->count; i++)
+  {
+    r.x0 = gx_int16_min(r.x0, _dirty->rects[i].x0);
+    r.y0 = gx_int16_min(r.y0, _dirty->rects[i].y0);
+    r.x1 = gx_int16_max(r.x1, _dirty->rects[i].x1);
+    r.y1 = gx_int16_max(r.y1, _dirty->rects[i].y1);
+  }
+  clearDirty();
+  _updateRegion(r);
+}
+
+void GxEPD::_updateRegion(const dirty_rect& r)
+{
+  // learned partial refresh not faster than full refresh
+  uint32_t full_us = _busy_times ? _busy_times->expected_us[kind_full_refresh] : 0;
+  if (full_us && (_busy_times->expected_us[kind_partial_refresh] >= full_us))
+  {
+    update();
+    return;
+  }
+  bool shadow_valid = _shadow_valid; // invalidated by updateWindow()
+  updateWindow(r.x0, r.y0, r.x1 - r.x0 + 1, r.y1 - r.y0 + 1, false);
+  if (!shadow_valid || !_shadow || !_buffer_black) return;
+  // the window sent is at least the dirty region
+  _copyToShadow(r);
+  _shadow_valid = true;
+}
+
+void GxEPD::_copyToShadow(const dirty_rect& r)
+{
+  uint16_t first = r.x0 / 8;
+  uint16_t n = r.x1 / 8 - first + 1;
+  uint8_t* shadow_red = _shadow + _buffer_size;
+  for (int32_t y = r.y0; (y <= r.y1) && (y < _buffer_rows); y++)
+  {
+    uint32_t i = uint32_t(y) * _buffer_row_bytes + first;
+    memcpy(_shadow + i, _buffer_black + i, n);
+    if (_buffer_red) memcpy(shadow_red + i, _buffer_red + i, n);
+  }
+}
+
+void GxEPD::updateChanged()
+{
+  if (!_shadow || !_buffer_black)
+  {
+    updateDirty();
+    return;
+  }
+  clearDirty();
+  dirty_rect r = {0, 0, int16_t(WIDTH - 1), int16_t(_buffer_rows - 1)};
+  if (_shadow_valid)
+  {
+    r.y1 = -1; // nothing changed
+    const uint8_t* shadow_red = _shadow + _buffer_size;
+    for (uint16_t y = 0; y < _buffer_rows; y++)
+    {
+      uint32_t i = uint32_t(y) * _buffer_row_bytes;
+      uint16_t first, last, red_first, red_last;
+      bool changed = diffSpan(_buffer_black + i, _shadow + i, _buffer_row_bytes, first, last);
+      if (_buffer_red && diffSpan(_buffer_red + i, shadow_red + i, _buffer_row_bytes, red_first, red_last))
+      {
+        first = changed ? gx_uint16_min(first, red_first) : red_first;
+        last = changed ? gx_uint16_max(last, red_last) : red_last;
+        changed = true;
+      }
+      if (!changed) continue;
+      // whole bytes in x, windows of the controllers are byte aligned
+      int16_t x0 = first * 8;
+      int16_t x1 = gx_int16_min(last * 8 + 7, WIDTH - 1);
+      if (r.y1 < 0)
+      {
+        r.x0 = x0;
+        r.x1 = x1;
+        r.y0 = y;
+      }
+      r.x0 = gx_int16_min(r.x0, x0);
+      r.x1 = gx_int16_max(r.x1, x1);
+      r.y1 = y;
+    }
+  }
+  if (r.y1 >= 0)
+  {
+    if (hasUpdateWindow()) _updateRegion(r);
+    else update();
+  }
+  bufferUpdated();
+}
+
+void GxEPD::bufferUpdated()
+{
+  clearDirty();
+  if (!_shadow || !_buffer_black) return;
+  memcpy(_shadow, _buffer_black, _buffer_size);
+  if (_buffer_red) memcpy(_shadow + _buffer_size, _buffer_red, _buffer_size);
+  _shadow_valid = true;
+}
+
+void GxEPD::bufferFilled(uint16_t color)
+{
+  markDirty(0, 0, WIDTH - 1, HEIGHT - 1);
+  if (_isRecording()) _recordOp(list_op_fill_screen, &color, sizeof(color));
+}
+
+void GxEPD::setDisplayList(uint8_t* list, uint16_t size)
+{
+  _list = 0;
+  if (!list) return;
+  uint8_t align = (alignof(list_header) - uintptr_t(list) % alignof(list_header)) % alignof(list_header);
+  if (size < align + sizeof(list_header)) return;
+  _list = (list_header*) (list + align);
+  _list->size = size - align - sizeof(list_header);
+  _list->used = 0;
+  _list->state = list_none;
+}
+
+void GxEPD::drawPage(void (*drawCallback)(void))
+{
+  if (!_beginPage()) return;
+  drawCallback();
+  _endPage();
+}
+
+void GxEPD::drawPage(void (*drawCallback)(uint32_t), uint32_t p)
+{
+  if (!_beginPage()) return;
+  drawCallback(p);
+  _endPage();
+}
+
+void GxEPD::drawPage(void (*drawCallback)(const void*), const void* p)
+{
+  if (!_beginPage()) return;
+  drawCallback(p);
+  _endPage();
+}
+
+void GxEPD::drawPage(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
+{
+  if (!_beginPage()) return;
+  drawCallback(p1, p2);
+  _endPage();
+}
+
+bool GxEPD::_beginPage()
+{
+  _shadow_valid = false; // drawPaged() writes to screen from the pages
+  if (!_list || !_buffer_page) return true;
+  int16_t page = *_buffer_page;
+  bool first = (_list->state == list_none) || (page <= _list->page);
+  _list->page = page;
+  if (first)
+  {
+    // record, and draw this page
+    _list->used = 0;
+    _list->last_rect = _list->size;
+    _list->x = 0;
+    _list->y = 0;
+    _list->color = GxEPD_BLACK;
+    _list->state = list_recording;
+    uint8_t r = getRotation();
+    _recordOp(list_op_rotation, &r, 1);
+    _selectPixelWriter();
+    _updateClip();
+    return true;
+  }
+  if (_list->state != list_recorded) return true;
+  _replayList();
+  return false;
+}
+
+void GxEPD::_endPage()
+{
+  if (!_isRecording()) return;
+  _list->state = list_recorded;
+  _selectPixelWriter();
+  _updateClip();
+}
+
+bool GxEPD::_recordOp(uint8_t op, const void* data, uint8_t n)
+{
+  if (_list->used + 1 + n > _list->size)
+  {
+    // the callback runs on each page
+    _list->state = list_overflow;
+    _selectPixelWriter();
+    _updateClip();
+    return false;
+  }
+  _listOps()[_list->used] = op;
+  memcpy(_listOps() + _list->used + 1, data, n);
+  _list->last_rect = (op <= list_op_near_pixel) ? _list->used : _list->size;
+  _list->used += 1 + n;
+  return true;
+}
+
+bool GxEPD::_recordRectOp(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  int16_t dx = x - _list->x;
+  int16_t dy = y - _list->y;
+  bool recorded;
+  bool near = (dx >= -128) && (dx <= 127) && (dy >= -128) && (dy <= 127);
+  if (near && (w == 1) && (h == 1))
+  {
+    int8_t r[2] = {int8_t(dx), int8_t(dy)};
+    recorded = _recordOp(list_op_near_pixel, r, sizeof(r));
+  }
+  else if (near && (w <= 255) && (h <= 255))
+  {
+    list_near_rect r = {int8_t(dx), int8_t(dy), uint8_t(w), uint8_t(h)};
+    recorded = _recordOp(list_op_near_rect, &r, sizeof(r));
+  }
+  else
+  {
+    list_rect r = {x, y, w, h};
+    recorded = _recordOp(list_op_rect, &r, sizeof(r));
+  }
+  _list->x = x;
+  _list->y = y;
+  return recorded;
+}
+
+void GxEPD::_recordRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if ((_list->last_rect < _list->size) && (color == _list->color))
+  {
+    // extends the last rect by an adjacent rect, e.g. pixel runs of text, its origin stays
+    uint8_t* op = _listOps() + _list->last_rect;
+    int16_t lw = 1, lh = 1;
+    if (*op == list_op_near_rect)
+    {
+      lw = op[3];
+      lh = op[4];
+    }
+    else if (*op == list_op_rect)
+    {
+      list_rect r;
+      memcpy(&r, op + 1, sizeof(r));
+      lw = r.w;
+      lh = r.h;
+    }
+    bool merged = true;
+    if ((_list->y == y) && (lh == h) && (_list->x + lw == x)) lw += w;
+    else if ((_list->x == x) && (lw == w) && (_list->y + lh == y)) lh += h;
+    else merged = false;
+    if (merged)
+    {
+      // rewrite the last op, same origin
+      int16_t x0 = _list->x, y0 = _list->y;
+      _list->used = _list->last_rect;
+      if (*op == list_op_rect)
+      {
+        list_rect r = {x0, y0, lw, lh};
+        _recordOp(list_op_rect, &r, sizeof(r));
+      }
+      else
+      {
+        // relative to the previous origin
+        _list->x -= int8_t(op[1]);
+        _list->y -= int8_t(op[2]);
+        _recordRectOp(x0, y0, lw, lh);
+      }
+      return;
+    }
+  }
+  if (color != _list->color)
+  {
+    if (!_recordOp(list_op_color, &color, sizeof(color))) return;
+    _list->color = color;
+  }
+  _recordRectOp(x, y, w, h);
+}
+
+void GxEPD::_recordPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if ((uint16_t(x) >= uint16_t(_width)) || (uint16_t(y) >= uint16_t(_height))) return;
+  void (GxEPD::*writer)(int16_t x, int16_t y, uint16_t color) = _list->writer;
+  _recordRect(x, y, 1, 1, color); // may end the recording on overflow
+  (this->*writer)(x, y, color);
+}
+
+void GxEPD::_replayList()
+{
+  uint16_t i = 0;
+  int16_t x = 0, y = 0; // origin of the last rect
+  uint16_t color = GxEPD_BLACK;
+  while (i < _list->used)
+  {
+    uint8_t op = _listOps()[i++];
+    switch (op)
+    {
+      case list_op_rect:
+        {
+          list_rect r;
+          memcpy(&r, _listOps() + i, sizeof(r));
+          i += sizeof(r);
+          x = r.x;
+          y = r.y;
+          fillRect(x, y, r.w, r.h, color);
+        }
+        break;
+      case list_op_near_rect:
+        {
+          list_near_rect r;
+          memcpy(&r, _listOps() + i, sizeof(r));
+          i += sizeof(r);
+          x += r.dx;
+          y += r.dy;
+          fillRect(x, y, r.w, r.h, color);
+        }
+        break;
+      case list_op_near_pixel:
+        x += int8_t(_listOps()[i++]);
+        y += int8_t(_listOps()[i++]);
+        drawPixel(x, y, color);
+        break;
+      case list_op_color:
+        memcpy(&color, _listOps() + i, sizeof(color));
+        i += sizeof(color);
+        break;
+      case list_op_bitmap:
+        {
+          list_bitmap b;
+          memcpy(&b, _listOps() + i, sizeof(b));
+          i += sizeof(b);
+          blitBitmap(b.bitmap, b.x, b.y, b.w, b.h, b.fg_color, b.bg_color, b.mode);
+        }
+        break;
+      case list_op_fill_screen:
+        {
+          uint16_t color;
+          memcpy(&color, _listOps() + i, sizeof(color));
+          i += sizeof(color);
+          fillScreen(color);
+        }
+        break;
+      case list_op_rotation:
+        setRotation(_listOps()[i++]);
+        break;
+    }
+  }
+}
+
+void GxEPD::fillBufferBits(uint8_t* buffer, int16_t x, int16_t y, int16_t w, int16_t h, bool set)
+{
+  uint8_t* row = buffer + uint32_t(y) * _buffer_row_bytes;
+  uint16_t first = x >> 3;
+  uint16_t last = (x + w - 1) >> 3;
+  uint8_t first_mask = 0xFF >> (x & 7);
+  uint8_t last_mask = 0xFF << (7 - ((x + w - 1) & 7));
+  uint8_t fill = set ? 0xFF : 0x00;
+  if (first == last) first_mask &= last_mask;
+  else if ((first_mask == 0xFF) && (last_mask == 0xFF) && (last - first + 1 == _buffer_row_bytes))
+  {
+    // whole rows, one block
+    memset(row, fill, uint32_t(h) * _buffer_row_bytes);
+    return;
+  }
+  for (; h > 0; h--, row += _buffer_row_bytes)
+  {
+    if (set) row[first] |= first_mask;
+    else row[first] &= ~first_mask;
+    if (first == last) continue;
+    if (last - first > 1) memset(row + first + 1, fill, last - first - 1);
+    if (set) row[last] |= last_mask;
+    else row[last] &= ~last_mask;
+  }
+}
+
+void GxEPD::writeBufferData(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, int32_t n, bool invert)
+{
+  if (n <= 0) return;
+  uint32_t available = (idx < buffer_size) ? buffer_size - idx : 0;
+  if (available > uint32_t(n)) available = n;
+  if (available > 0) io.writeDataTransaction(buffer + idx, available, invert);
+  if (uint32_t(n) > available)
+  {
+    // beyond the (page) buffer, e.g. full screen update on AVR
+    uint8_t data = invert ? 0xFF : 0x00;
+    io.startTransaction();
+    for (uint32_t i = available; i < uint32_t(n); i++)
+    {
+      io.writeData(data);
+    }
+    io.endTransaction();
+  }
+}
+
+void GxEPD::selectSPIFrequency(GxIO& io, uint32_t controller_max)
+{
+  if (_spi_frequency == spi_clock_default) _spi_frequency_active = GxEPD_SPI_CLOCK_DEFAULT;
+  else if (_spi_frequency == spi_clock_max) _spi_frequency_active = controller_max;
+  else _spi_frequency_active = _spi_frequency; // explicit override, not limited
+  io.setFrequency(_spi_frequency_active);
+}
+
+bool GxEPD::verifyRamReadback(GxIO& io, const uint8_t* pattern, uint16_t n)
+{
+  bool ok = true;
+  io.setFrequency(GxEPD_SPI_CLOCK_READ);
+  io.startTransaction();
+  io.writeCommand(0x27); // read RAM
+  io.readData(); // first byte read is dummy
+  for (uint16_t i = 0; i < n; i++)
+  {
+    if (io.readData() != pattern[i]) ok = false;
+  }
+  io.endTransaction();
+  if (!ok) _spi_frequency_active = GxEPD_SPI_CLOCK_DEFAULT;
+  io.setFrequency(_spi_frequency_active);
+  return ok;
+}
+
+#if defined(GxEPD_STATISTICS)
+void GxEPD::resetStatistics()
+{
+  memset(&_statistics, 0, sizeof(_statistics));
+  _busy_wait_phase = phase_other;
+}
+#endif
+
+GxEPD::busy_phase GxEPD::busyPhase(busy_wait wait)
+{
+  switch (wait)
+  {
+    case wait_power_on:
+      return phase_power_on;
+    case wait_full_refresh:
+    case wait_partial_refresh:
+    case wait_refresh:
+      return phase_refresh;
+    case wait_power_off:
+      return phase_power_off;
+    default:
+      return phase_other;
+  }
+}
+
+void GxEPD::onBusyWait(busy_wait wait, int8_t busy_pin)
+{
+  _busy_wait_begin = micros();
+#if defined(GxEPD_STATISTICS)
+  _busy_wait_phase = busyPhase(wait);
+#endif
+  _busy_wait_kind = _busy_times ? busyKind(wait) : kind_none;
+  _busy_presleep = !_busy_idle_callback && (_busy_wait_kind < kind_none) && (_busy_times->expected_us[_busy_wait_kind] > 0);
+  _busy_observed = false;
+  _busy_timed_out = false;
+  if (_refresh_wait_hook && (busyPhase(wait) == phase_refresh))
+  {
+    _refresh_wait_hook(_refresh_wait_hook_p);
+  }
+  if (_busy_idle_callback && (busy_pin >= 0) && (digitalPinToInterrupt(busy_pin) != NOT_AN_INTERRUPT))
+  {
+    _busy_edge = false;
+    _busy_interrupt_pin = busy_pin;
+    attachInterrupt(digitalPinToInterrupt(busy_pin), _busyEdgeISR, CHANGE);
+  }
+  _busy_wait_start = micros(); // after the hook, time of other displays not counted
+}
+
+void GxEPD::busyIdle()
+{
+  if (_busy_presleep && (_busy_wait_kind < kind_none))
+  {
+    // no polling until shortly before the expected end, 1/8 margin for variation e.g. with temperature
+    _busy_presleep = false;
+    uint32_t wake = _busy_times->expected_us[_busy_wait_kind] - _busy_times->expected_us[_busy_wait_kind] / 8;
+    uint32_t elapsed = micros() - _busy_wait_begin;
+    if (elapsed < wake)
+    {
+      delay((wake - elapsed) / 1000);
+      return;
+    }
+  }
+  _busy_observed = true;
+  if (_busy_interrupt_pin < 0)
+  {
+    delay(1);
+    return;
+  }
+  // the edge may have happened since the last BUSY check, then check again without idle
+  if (!_busy_edge && _busy_idle_callback) _busy_idle_callback(_busy_interrupt_pin, _busy_idle_callback_p);
+  _busy_edge = false;
+}
+
+void GxEPD_ISR_ATTR GxEPD::_busyEdgeISR()
+{
+  _busy_edge = true;
+}
+
+GxEPD::busy_kind GxEPD::busyKind(busy_wait wait)
+{
+  // wait_power_on to wait_power_off are the learned kinds, same values
+  return (wait <= wait_power_off) ? busy_kind(wait) : kind_none;
+}
+
+void GxEPD::finish()
+{
+  while (isBusy()) busyIdle();
+}
+
+void GxEPD::checkIdle()
+{
+  if (!_kept_powered || isBusy()) return;
+  if (!_power_policy.keep_powered || (millis() - _idle_start >= _power_policy.idle_ms)) powerDown();
+}
+
+bool GxEPD::deferPowerOff()
+{
+  if (!_power_policy.keep_powered) return false;
+  _kept_powered = true;
+  _idle_start = millis();
+  return true;
+}
+
+void GxEPD::startBusyPoll(busy_wait wait)
+{
+#if defined(GxEPD_STATISTICS)
+  _busy_wait_phase = busyPhase(wait);
+#endif
+  _busy_wait_kind = kind_none; // polled by the application, not observed within one poll
+  _busy_presleep = false;
+  _busy_timed_out = false;
+  _busy_wait_start = micros();
+}
+
+bool GxEPD::pollBusy(bool busy, uint32_t timeout_us)
+{
+  if (busy && (micros() - _busy_wait_start <= timeout_us)) return true;
+  if (busy) onBusyTimeout();
+  onBusyWaitDone();
+  return false;
+}
+
+void GxEPD::onBusyWaitDone()
+{
+  if (_busy_interrupt_pin >= 0)
+  {
+    detachInterrupt(digitalPinToInterrupt(_busy_interrupt_pin));
+    _busy_interrupt_pin = -1;
+  }
+  _busy_presleep = false; // BUSY released before the first busyIdle()
+  if ((_busy_wait_kind < kind_none) && !_busy_timed_out)
+  {
+    uint32_t& expected = _busy_times->expected_us[_busy_wait_kind];
+    uint32_t duration = micros() - _busy_wait_begin;
+    // learn from observed ends only, else duration is an upper bound, e.g. after the learned sleep or the refresh wait hook
+    if (_busy_observed) expected = expected ? (3 * expected + duration) / 4 : duration;
+    else if (duration < expected) expected = duration;
+  }
+#if defined(GxEPD_STATISTICS)
+  uint32_t elapsed = micros() - _busy_wait_start;
+  _statistics.wait_us[_busy_wait_phase] += elapsed;
+  _statistics.waits[_busy_wait_phase]++;
+  _statistics.last_wait_us[_busy_wait_phase] = elapsed;
+#endif
+}
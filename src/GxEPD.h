@@ -21,6 +21,11 @@
 
 #pragma GCC diagnostic ignored "-Wsign-compare"
 
+// maximum number of dirty rectangles tracked for GxEPD::updateDirty(), more are merged
+#ifndef GxEPD_DIRTY_RECTS
+#define GxEPD_DIRTY_RECTS 4
+#endif
+
 // the only colors supported by any of these displays; mapping of other colors is class specific
 #define GxEPD_BLACK     0x0000
 #define GxEPD_DARKGREY  0x7BEF      /* 128, 128, 128 */
@@ -28,6 +33,51 @@
 #define GxEPD_WHITE     0xFFFF
 #define GxEPD_RED       0xF800      /* 255,   0,   0 */
 
+// SPI write clock profiles, maximum write clock of the controller families, see GxEPD::setSPIFrequency()
+// from the serial interface timing of the datasheets, serial clock cycle (write)
+#define GxEPD_SPI_CLOCK_DEFAULT  4000000 // safe for all controllers, was used for all display classes
+#define GxEPD_SPI_CLOCK_SSD168x 20000000 // SSD1675B, SSD1680, SSD1681 : 50ns
+#define GxEPD_SPI_CLOCK_UC8151D 10000000 // UC8151D : 100ns
+#define GxEPD_SPI_CLOCK_IL       4000000 // IL38xx, IL03xx, IL91874, GD7965, HINK panels : not verified, kept at default
+#define GxEPD_SPI_CLOCK_READ     2000000 // for read back, read cycles are slower than write cycles
+
+// busy wait statistics of a display, since construction or resetStatistics(), indexed by GxEPD::busy_phase
+// the data transfer time of the display is counted by its io class, see GxIO_Statistics; with GxEPD_STATISTICS only
+struct GxEPD_Statistics
+{
+  uint32_t wait_us[4]; // accumulated busy wait durations
+  uint16_t waits[4]; // number of busy waits
+  uint32_t last_wait_us[4]; // duration of the last busy wait
+};
+
+// learned busy wait durations of a display, indexed by GxEPD::busy_kind, 0 : not learned yet
+// busy waits of a known kind sleep until shortly before the expected end before polling BUSY
+// in caller memory, see GxEPD::setBusyTimes(), e.g. in RTC memory to keep them across deep sleep
+struct GxEPD_BusyTimes
+{
+  uint32_t expected_us[4];
+};
+
+// regions drawn on a display, for GxEPD::updateDirty(), in caller memory, see GxEPD::setDirtyRegions()
+struct GxEPD_DirtyRegions
+{
+  struct rect
+  {
+    int16_t x0, y0, x1, y1; // inclusive, in controller orientation
+  } rects[GxEPD_DIRTY_RECTS];
+  uint8_t count;
+  // copy of the last added or grown rectangle, checked first, one unsigned compare per coordinate
+  int16_t hit_x, hit_y;
+  uint16_t hit_w, hit_h;
+};
+
+// power policy of a display, see GxEPD::setPowerPolicy()
+struct GxEPD_PowerPolicy
+{
+  bool keep_powered; // stay powered after operations, the next operation needs no reset and power on
+  uint32_t idle_ms; // power off and deep sleep after this time without operation, by GxEPD::checkIdle()
+};
+
 //class GxEPD : public Adafruit_GFX
 class GxEPD : public GxFont_GFX
 {
@@ -41,17 +91,64 @@ class GxEPD : public GxFont_GFX
       bm_invert = (1 << 1),
       bm_flip_x = (1 << 2),
       bm_flip_y = (1 << 3),
-      bm_r90 = (1 << 4),
+      bm_r90 = (1 << 4), // clockwise, w x h bitmap drawn as h x w, before flips, see GxEPD::drawBitmapBM()
       bm_r180 = (1 << 5),
       bm_r270 = bm_r90 | bm_r180,
       bm_partial_update = (1 << 6),
       bm_invert_red = (1 << 7),
       bm_transparent = (1 << 8)
     };
+    // phases of the display operations with busy waits
+    enum busy_phase
+    {
+      phase_power_on = 0,
+      phase_refresh = 1,
+      phase_power_off = 2,
+      phase_other = 3 // reset, busy before command, other waits
+    };
+    // kinds of busy waits with learned durations, see GxEPD_BusyTimes
+    enum busy_kind
+    {
+      kind_power_on = 0,
+      kind_full_refresh = 1, // update, drawPaged
+      kind_partial_refresh = 2, // updateWindow, updateToWindow, drawPagedToWindow
+      kind_power_off = 3,
+      kind_none = 4 // not learned, e.g. operations that may use full or partial refresh, "update initial"
+    };
+    // busy waits of the display classes, select the busy_phase and the busy_kind
+    enum busy_wait
+    {
+      wait_power_on = 0, // phase_power_on, kind_power_on
+      wait_full_refresh = 1, // phase_refresh, kind_full_refresh : update, drawPaged
+      wait_partial_refresh = 2, // phase_refresh, kind_partial_refresh : updateWindow, updateToWindow, drawPagedToWindow
+      wait_power_off = 3, // phase_power_off, kind_power_off
+      wait_refresh = 4, // phase_refresh, kind_none : eraseDisplay, drawBitmap, drawPicture, "update initial"
+      wait_other = 5 // phase_other, kind_none : reset, busy before command, other waits
+    };
   public:
     //GxEPD(int16_t w, int16_t h) : Adafruit_GFX(w, h) {};
-    GxEPD(int16_t w, int16_t h) : GxFont_GFX(w, h) {};
-    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    GxEPD(int16_t w, int16_t h) : GxFont_GFX(w, h), _spi_frequency(spi_clock_default), _spi_frequency_active(GxEPD_SPI_CLOCK_DEFAULT), _busy_interrupt_pin(-1),
+      _kept_powered(false), _idle_start(0), _buffer_colors(buffer_none), _buffer_black(0), _buffer_red(0), _buffer_size(0),
+      _buffer_row_bytes(0), _buffer_page_height(0), _buffer_page(0), _buffer_rows(0),
+      _page_buffer(0), _page_buffer_size(0), _paged_black(0), _paged_red(0), _paged_size(0), _paged_page_height(0), _dirty(0), _shadow(0), _shadow_valid(false),
+      _list(0),
+      _clip_x0(0), _clip_y0(0), _clip_x1(-1), _clip_y1(-1), _clip_page(-1),
+      _pixel_writer(&GxEPD::_writeNoPixel), _buffer_held(false)
+    {
+      _power_policy.keep_powered = false;
+      _power_policy.idle_ms = 0;
+      _busy_times = 0;
+      _busy_wait_kind = kind_none;
+      _busy_presleep = false;
+      _busy_wait_start = 0;
+#if defined(GxEPD_STATISTICS)
+      resetStatistics();
+#endif
+    };
+    // to buffer, on the buffers described by the display class, see setBufferLayout(), path selected by setRotation()
+    // overridden by display classes with own pixel mapping (GxGDE0213B1 y flip, HINKE0154A35/HINKE029A14/HINKE042A11 x/y swap)
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void setRotation(uint8_t r);
     virtual void init(uint32_t serial_diag_bitrate = 0) = 0; // = 0 : disabled
     virtual void fillScreen(uint16_t color) = 0; // to buffer
     virtual void update(void) = 0;
@@ -77,17 +174,316 @@ class GxEPD : public GxFont_GFX
     {
       drawBitmap(bitmap, size, m);
     };
+    // to buffer, byte-wise on the buffers described by the display class, see setBufferLayout(), else pixel by pixel
+    // to buffer, only the part on the current page of drawPaged(), same pixels as Adafruit_GFX
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     virtual void eraseDisplay(bool using_partial_update = false) {};
     // partial update of rectangle from buffer to screen, does not power off
     virtual void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) {};
+    // false for display classes without updateWindow() : GxGDEW0154Z04, HINKE0154A35, HINKE029A14, HINKE042A11
+    virtual bool hasUpdateWindow() {return true;};
     // partial update of rectangle at (xs,ys) from buffer to screen at (xd,yd), does not power off
     virtual void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true) {};
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     virtual void powerDown() = 0;
+    // SPI write clock used by the next init(), explicit frequency in Hz or one of
+    static const uint32_t spi_clock_default = 0; // GxEPD_SPI_CLOCK_DEFAULT, 4MHz
+    static const uint32_t spi_clock_max = 1; // maximum write clock of the controller family, GxEPD_SPI_CLOCK_xxx
+    void setSPIFrequency(uint32_t frequency) {_spi_frequency = frequency;};
+    uint32_t getSPIFrequency() {return _spi_frequency_active;};
+    // write test pattern to controller RAM and read it back, call after init(), content of controller RAM is changed
+    // supported for SSD168x controllers only, needs MISO connected to DIN (SDA) through a resistor, e.g. 1k
+    // falls back to GxEPD_SPI_CLOCK_DEFAULT on mismatch, returns false on mismatch or if not supported
+    virtual bool verifySPIFrequency() {return false;};
+    // non-blocking update, returns after the data transfer while the refresh continues, poll isBusy() or call finish()
+    // blocking by default, non-blocking on display classes with refresh state machine (GxGDEW042T2, GxGDEW075Z09)
+    virtual void updateAsync() {update();};
+    virtual void updateWindowAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true)
+    {
+      updateWindow(x, y, w, h, using_rotation);
+    };
+    // opt-in tracking of the regions drawn, for updateDirty(), caller memory, 0 to disable
+    void setDirtyRegions(GxEPD_DirtyRegions* dirty) {_dirty = dirty; clearDirty();};
+    // partial update of the regions drawn since the last update(), updateDirty() or clearDirty(), through one updateWindow()
+    // around all regions, as each window is a refresh; update() if the learned partial refresh is not faster than full
+    // regions are tracked in controller orientation when drawing with full buffer, not during drawPaged()
+    // update() instead if any region is dirty and the display class has no updateWindow() (see hasUpdateWindow()),
+    // and always without setDirtyRegions() or without buffer layout, as drawing is not tracked then
+    // (GxGDE0213B1, HINKE0154A35, HINKE029A14, HINKE042A11)
+    void updateDirty();
+    void clearDirty()
+    {
+      if (!_dirty) return;
+      _dirty->count = 0;
+      _dirty->hit_w = 0;
+    };
+    bool isDirty() {return _dirty && (_dirty->count > 0);};
+    // opt-in copy of the frame last sent by update() or updateChanged(), shadowBufferSize() bytes, 0 to disable
+    // writes to screen other than update(), updateChanged() and updateDirty() invalidate it, e.g. eraseDisplay(),
+    // drawPicture(), drawBitmap() to full screen, drawPaged() and updateWindow(); updateChanged() then sends the whole screen
+    void setShadowBuffer(uint8_t* shadow) {_shadow = shadow; _shadow_valid = false;};
+    uint32_t shadowBufferSize() {return _buffer_red ? 2 * _buffer_size : _buffer_size;};
+    void invalidateShadow() {_shadow_valid = false;};
+    // partial update of the byte spans of the buffer that differ from the shadow, through one updateWindow() around them,
+    // as updateDirty(); the whole screen if the shadow is not valid, updateDirty() without shadow
+    void updateChanged();
+    // opt-in display list for drawPaged() and drawPagedToWindow(), size bytes of caller memory, 0 to disable,
+    // the state of the list is kept at the start of the memory, about 20 bytes :
+    // the callback runs once on the first page, its drawing is recorded and replayed on the following pages,
+    // the callback runs on each page if the list overflows; the callback must draw the same on each page,
+    // bitmaps are recorded by address and must stay valid until drawPaged() returns
+    void setDisplayList(uint8_t* list, uint16_t size);
+    // bytes used by the last recording, 0 if it overflowed
+    uint16_t displayListUsed() {return (_list && (_list->state == list_recorded)) ? _list->used : 0;};
+    // opt-in page buffer for drawPaged() and drawPagedToWindow(), size bytes of caller memory, 0 to disable :
+    // the page height is size / bytes of a row (black and red row on 3 color displays), chosen at runtime,
+    // the buffer of the display class stays untouched; honored by display classes with runtime page height
+    // (GxGDEW042T2, GxGDEW075Z09), a buffer smaller than a row is ignored
+    void setPageBuffer(uint8_t* buffer, uint32_t size) {_page_buffer = buffer; _page_buffer_size = buffer ? size : 0;};
+    // advances the refresh state machine of a non-blocking update, true until it is complete
+    virtual bool isBusy() {return false;};
+    // waits for completion of a non-blocking update, called by the display classes before the next operation
+    void finish();
+    // power off and deep sleep after each operation by default, honored by some display classes (GxGDEW042T2, GxGDEW075Z09)
+    void setPowerPolicy(const GxEPD_PowerPolicy& policy) {_power_policy = policy;};
+    const GxEPD_PowerPolicy& getPowerPolicy() const {return _power_policy;};
+    // to be called periodically, e.g. from loop(), calls powerDown() if kept powered and idle for idle_ms
+    void checkIdle();
+    // hook called at the start of refresh waits of any display, e.g. by GxEPD_BusScheduler to use the bus meanwhile
+    static void setRefreshWaitHook(void (*hook)(void*), void* p = 0) {_refresh_wait_hook = hook; _refresh_wait_hook_p = p;};
+    // idle callback for busy waits, e.g. to enter light sleep, called instead of delay(1) between BUSY checks;
+    // an edge interrupt on the BUSY pin is attached during the wait, to wake the processor on the BUSY transition;
+    // the callback should also return after a limited time, BUSY is checked after each return for timeouts.
+    static void setBusyIdleCallback(void (*callback)(int8_t busy_pin, void* p), void* p = 0) {_busy_idle_callback = callback; _busy_idle_callback_p = p;};
+#if defined(GxEPD_STATISTICS)
+    const GxEPD_Statistics& getStatistics() const {return _statistics;};
+    void resetStatistics();
+#endif
+    // opt-in learning of busy wait durations, caller memory, zeroed or learned before, 0 to disable
+    void setBusyTimes(GxEPD_BusyTimes* times) {_busy_times = times;};
+    const GxEPD_BusyTimes* getBusyTimes() const {return _busy_times;};
   protected:
+    // register sets (LUTs and settings) loaded in the controller, tracked by display classes to skip redundant uploads
+    enum register_set
+    {
+      registers_unknown = 0, // after reset or deep sleep
+      registers_full_update,
+      registers_partial_update
+    };
+    // color mapping of the 1bpp buffers of the display classes
+    enum buffer_colors
+    {
+      buffer_none = 0, // not described, primitives pixel by pixel
+      buffer_bw, // black bit set for color 0
+      buffer_3c, // black bit set for black, red bit set for red
+      buffer_3c_red_inverted // black bit set for black, red bit cleared for red
+    };
+    // for the display classes : describes the buffers for the fast primitives, in controller orientation, MSB first;
+    // rows of row_bytes, red 0 for b/w, current_page -1 for full buffer else page of page_height rows;
+    // may be called again, e.g. to bind buffers of caller memory
+    void setBufferLayout(buffer_colors colors, uint8_t* black, uint8_t* red, uint32_t size, uint16_t row_bytes, uint16_t page_height, const int16_t* current_page);
+    // for the display classes with runtime page height : around the page loops of drawPaged() and drawPagedToWindow(),
+    // selects the buffer of setPageBuffer() in the buffer layout, restores the buffers of the display class
+    void beginPages();
+    void endPages();
+    // for the display classes : the buffers of the layout, the page buffer between beginPages() and endPages()
+    uint8_t* bufferBlack() {return _buffer_black;};
+    uint8_t* bufferRed() {return _buffer_red;};
+    uint32_t bufferSize() {return _buffer_size;};
+    // rows per page and pages of the layout, the last page may be partial
+    uint16_t pageHeight() {return _buffer_page_height;};
+    uint16_t pageCount() {return _buffer_page_height ? (HEIGHT + _buffer_page_height - 1) / _buffer_page_height : 0;};
+    // rows of the page in buffer orientation
+    uint16_t pageRows(int16_t page) {return gx_uint16_min(_buffer_page_height, HEIGHT - page * _buffer_page_height);};
+    // for fillScreen() of the display classes : fills the buffers of the layout, red ignored for b/w
+    void fillBuffers(uint8_t black, uint8_t red);
+    // called by the display classes at the start of each busy wait, calls the refresh wait hook for refresh waits
+    void onBusyWait(busy_wait wait, int8_t busy_pin = -1);
+    // called by the display classes between BUSY checks, idle callback or delay(1)
+    void busyIdle();
+    // called by the display classes at the end of each busy wait, for the learned durations and the statistics
+    void onBusyWaitDone();
+    // called by the display classes when a busy wait times out, the wait is not learned
+    void onBusyTimeout() {_busy_timed_out = true;};
+    // for the display classes : at the end of an operation, true if power off is deferred by the power policy
+    bool deferPowerOff();
+    // for the display classes : true if still powered from the end of the last operation
+    bool isKeptPowered() {return _kept_powered;};
+    // for the display classes : after power off
+    void onPowerOff() {_kept_powered = false;};
+    // for the refresh state machines : start of a busy wait polled by isBusy(), no refresh wait hook, no idle callback
+    void startBusyPoll(busy_wait wait);
+    // for the refresh state machines : true while busy and not timed out, else ends the busy wait
+    bool pollBusy(bool busy, uint32_t timeout_us);
+    // for the refresh state machines : the buffer is still to be sent after the refresh, drawing to it calls finish() first
+    void holdBuffer(bool held);
+    static busy_phase busyPhase(busy_wait wait);
+    static busy_kind busyKind(busy_wait wait);
+    // sets the SPI write clock selected by setSPIFrequency(), controller_max : GxEPD_SPI_CLOCK_xxx of the controller
+    void selectSPIFrequency(GxIO& io, uint32_t controller_max);
+    // read back n bytes with SSD16xx read RAM command 0x27 at GxEPD_SPI_CLOCK_READ, RAM pointer set by caller
+    // compare with pattern, falls back to GxEPD_SPI_CLOCK_DEFAULT on mismatch, restores write clock
+    bool verifyRamReadback(GxIO& io, const uint8_t* pattern, uint16_t n);
     void drawBitmapBM(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t m);
+    // for drawBitmapBM() : copies the bitmap into the buffers, byte-wise, shifted for unaligned x, 8x8 transposed for
+    // quarter turns of bm_r90, bm_r270 or rotation; false for flip modes or without buffer layout, fg_color is color for bm_transparent
+    bool blitBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t fg_color, uint16_t bg_color, int16_t mode);
+    // burst write of n bytes of buffer from index idx, bytes beyond buffer_size are sent as 0x00 (before invert)
+    static void writeBufferData(GxIO& io, const uint8_t* buffer, uint32_t buffer_size, uint32_t idx, int32_t n, bool invert);
+    // for the display classes : the buffer has been sent to the controller by update(), resets the dirty regions, updates the shadow
+    void bufferUpdated();
+    // for the display classes : at the end of fillScreen(), marks the screen dirty, recorded in the display list
+    void bufferFilled(uint16_t color);
+    // for the display classes : draws the current page of drawPaged() with the callback, or replays the display list
+    void drawPage(void (*drawCallback)(void));
+    void drawPage(void (*drawCallback)(uint32_t), uint32_t p);
+    void drawPage(void (*drawCallback)(const void*), const void* p);
+    void drawPage(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2);
+    // for the display classes : adds a rectangle in buffer orientation to the dirty regions, ignored during drawPaged()
+    void markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+    {
+      if (!_dirty || (_isDirtyHit(x0, y0) && _isDirtyHit(x1, y1))) return;
+      _addDirty(x0, y0, x1, y1);
+    };
+    // sets or clears the bits of a rectangle in buffer orientation, clipped by the caller
+    void fillBufferBits(uint8_t* buffer, int16_t x, int16_t y, int16_t w, int16_t h, bool set);
+    // buffer bits for color : black bit set, red bit set (before buffer_3c_red_inverted)
+    inline void bufferColorBits(uint16_t color, bool& black, bool& red)
+    {
+      black = false;
+      red = false;
+      if (_buffer_colors == buffer_bw) black = !color;
+      else if (color == GxEPD_BLACK) black = true;
+      else if (color == GxEPD_RED) red = true;
+      else if (color != GxEPD_WHITE)
+      {
+        if ((color & 0xF100) > (0xF100 / 2)) red = true;
+        else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2) black = true;
+      }
+    };
     static inline uint16_t gx_uint16_min(uint16_t a, uint16_t b) {return (a < b ? a : b);};
     static inline uint16_t gx_uint16_max(uint16_t a, uint16_t b) {return (a > b ? a : b);};
+    static inline int16_t gx_int16_min(int16_t a, int16_t b) {return (a < b ? a : b);};
+    static inline int16_t gx_int16_max(int16_t a, int16_t b) {return (a > b ? a : b);};
+    static inline int32_t gx_int32_min(int32_t a, int32_t b) {return (a < b ? a : b);};
+    static inline int32_t gx_int32_max(int32_t a, int32_t b) {return (a > b ? a : b);};
+  private:
+    uint32_t _spi_frequency, _spi_frequency_active;
+#if defined(GxEPD_STATISTICS)
+    GxEPD_Statistics _statistics;
+    busy_phase _busy_wait_phase;
+#endif
+    uint32_t _busy_wait_start;
+    uint32_t _busy_wait_begin; // before the refresh wait hook, for the learned durations
+    uint8_t _busy_wait_kind;
+    bool _busy_presleep; // learned sleep pending
+    bool _busy_observed; // BUSY seen active when polled, duration observed within one poll
+    bool _busy_timed_out; // ended by timeout, not by BUSY released
+    GxEPD_BusyTimes* _busy_times; // 0 if not learned
+    static void (*_refresh_wait_hook)(void*);
+    static void* _refresh_wait_hook_p;
+    static void (*_busy_idle_callback)(int8_t, void*);
+    static void* _busy_idle_callback_p;
+    static volatile bool _busy_edge;
+    static void _busyEdgeISR();
+    int8_t _busy_interrupt_pin; // BUSY pin with interrupt attached during wait, else -1
+    GxEPD_PowerPolicy _power_policy;
+    bool _kept_powered;
+    uint32_t _idle_start;
+    buffer_colors _buffer_colors;
+    uint8_t* _buffer_black;
+    uint8_t* _buffer_red;
+    uint32_t _buffer_size;
+    uint16_t _buffer_row_bytes;
+    uint16_t _buffer_page_height;
+    const int16_t* _buffer_page;
+    uint16_t _buffer_rows; // of the full buffer
+    uint8_t* _page_buffer;
+    uint32_t _page_buffer_size;
+    // buffers of the display class while the page buffer is selected, _paged_page_height 0 if not selected
+    uint8_t* _paged_black;
+    uint8_t* _paged_red;
+    uint32_t _paged_size;
+    uint16_t _paged_page_height;
+    typedef GxEPD_DirtyRegions::rect dirty_rect;
+    GxEPD_DirtyRegions* _dirty; // 0 if not tracked
+    bool _isDirtyHit(int16_t x, int16_t y)
+    {
+      return (uint16_t(x - _dirty->hit_x) < _dirty->hit_w) && (uint16_t(y - _dirty->hit_y) < _dirty->hit_h);
+    };
+    void _addDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    // one updateWindow() of r, keeps the shadow valid; update() if the learned partial refresh is not faster
+    void _updateRegion(const dirty_rect& r);
+    void _copyToShadow(const dirty_rect& r);
+    uint8_t* _shadow; // black plane, followed by red plane for 3 color buffers
+    bool _shadow_valid;
+    // display list, ops of an op code byte followed by the struct of the op;
+    // rects in the color of the last list_op_color (initially black), near rects and pixels (dx, dy) relative to the previous rect
+    enum list_state {list_none, list_recording, list_recorded, list_overflow};
+    enum list_op {list_op_rect, list_op_near_rect, list_op_near_pixel, list_op_color, list_op_bitmap, list_op_fill_screen, list_op_rotation};
+    struct list_rect
+    {
+      int16_t x, y, w, h;
+    };
+    struct list_near_rect
+    {
+      int8_t dx, dy;
+      uint8_t w, h;
+    };
+    struct list_bitmap
+    {
+      const uint8_t* bitmap;
+      uint16_t x, y, w, h, fg_color, bg_color;
+      int16_t mode;
+    };
+    // state of the display list, at the start of the caller memory, followed by the ops
+    struct list_header
+    {
+      void (GxEPD::*writer)(int16_t x, int16_t y, uint16_t color); // pixel writer while recording
+      uint16_t size; // of the ops
+      uint16_t used;
+      uint16_t last_rect; // offset of the last op if it is a rect, for merging, else size
+      int16_t x, y; // origin of the last rect
+      uint16_t color;
+      int16_t page; // page of the last drawPage(), a page not after it starts a new recording
+      list_state state;
+    };
+    list_header* _list; // 0 without display list
+    uint8_t* _listOps() {return (uint8_t*)(_list + 1);};
+    bool _isRecording() {return _list && (_list->state == list_recording);};
+    bool _beginPage();
+    void _endPage();
+    bool _recordOp(uint8_t op, const void* data, uint8_t n);
+    bool _recordRectOp(int16_t x, int16_t y, int16_t w, int16_t h);
+    void _recordRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void _recordPixel(int16_t x, int16_t y, uint16_t color);
+    void _replayList();
+    // clip rectangle, inclusive, in rotated coordinates : the screen, or the part of it on the current page of drawPaged();
+    // the screen while recording a display list; follows the page, updated with rotation and display list state
+    int16_t _clip_x0, _clip_y0, _clip_x1, _clip_y1;
+    int16_t _clip_page;
+    void _updateClip();
+    void _checkClip()
+    {
+      if (*_buffer_page != _clip_page) _updateClip();
+    };
+    void (GxEPD::*_pixel_writer)(int16_t x, int16_t y, uint16_t color);
+    void _selectPixelWriter();
+    // plane bits of a bitmap blit, for source bits set (fg) and cleared (bg)
+    struct blit_planes
+    {
+      uint8_t fg_black, bg_black, fg_red, bg_red, invert;
+      bool transparent;
+    };
+    void _blitByte(const blit_planes& planes, uint32_t i, uint8_t bits, uint8_t mask);
+    template <uint8_t rotation, bool bw> void _writeBufferPixel(int16_t x, int16_t y, uint16_t color);
+    void _writeNoPixel(int16_t x, int16_t y, uint16_t color) {};
+    bool _buffer_held;
+    void _writeHeldPixel(int16_t x, int16_t y, uint16_t color);
+    void _releaseBuffer();
 };
 
 #endif
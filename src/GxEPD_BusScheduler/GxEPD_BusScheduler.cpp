@@ -0,0 +1,72 @@
+// class GxEPD_BusScheduler : runs operations of several displays on one shared SPI bus
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#include "GxEPD_BusScheduler.h"
+
+GxEPD_BusScheduler::GxEPD_BusScheduler() : _count(0), _active_count(0)
+{
+}
+
+bool GxEPD_BusScheduler::add(GxEPD& display, void (*operation)(GxEPD& display, const void* p), const void* p)
+{
+  if (_count >= GxEPD_BusScheduler_MAX_OPERATIONS) return false;
+  _operations[_count].display = &display;
+  _operations[_count].operation = operation;
+  _operations[_count].p = p;
+  _operations[_count].done = false;
+  _count++;
+  return true;
+}
+
+bool GxEPD_BusScheduler::addUpdate(GxEPD& display)
+{
+  return add(display, _update, 0);
+}
+
+void GxEPD_BusScheduler::run()
+{
+  GxEPD::setRefreshWaitHook(_onRefreshWait, this);
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    // operations postponed because their display was busy with a previous one
+    if (!_operations[i].done) _runNext();
+  }
+  GxEPD::setRefreshWaitHook(0);
+  _count = 0;
+}
+
+void GxEPD_BusScheduler::_update(GxEPD& display, const void* p)
+{
+  display.update();
+}
+
+void GxEPD_BusScheduler::_onRefreshWait(void* p)
+{
+  // the waiting display doesn't use the bus until its refresh is done
+  static_cast<GxEPD_BusScheduler*>(p)->_runNext();
+}
+
+void GxEPD_BusScheduler::_runNext()
+{
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    Operation& op = _operations[i];
+    if (op.done || _isActive(op.display)) continue;
+    // first pending operation of a display not in the nesting, runs until its own refresh wait starts the next
+    op.done = true;
+    _active[_active_count++] = op.display;
+    op.operation(*op.display, op.p);
+    _active_count--;
+    return;
+  }
+}
+
+bool GxEPD_BusScheduler::_isActive(GxEPD* display)
+{
+  for (uint8_t i = 0; i < _active_count; i++)
+  {
+    if (_active[i] == display) return true;
+  }
+  return false;
+}
@@ -0,0 +1,44 @@
+// class GxEPD_BusScheduler : runs operations of several displays on one shared SPI bus
+//
+// operations are queued with add() and run by run(); while a display waits for its refresh,
+// the next queued operation of another display is started, to stream its data meanwhile.
+// refreshes overlap, the total time is about the sum of the transfers plus the longest refresh.
+// needs a separate BUSY line per display, or-ed BUSY lines work but wait for all displays.
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _GxEPD_BusScheduler_H_
+#define _GxEPD_BusScheduler_H_
+
+#include "../GxEPD.h"
+
+#define GxEPD_BusScheduler_MAX_OPERATIONS 8
+
+class GxEPD_BusScheduler
+{
+  public:
+    GxEPD_BusScheduler();
+    // queue operation(display, p), returns false if the queue is full
+    bool add(GxEPD& display, void (*operation)(GxEPD& display, const void* p), const void* p = 0);
+    // queue display.update()
+    bool addUpdate(GxEPD& display);
+    // run all queued operations, returns when all displays are done; the queue is empty after
+    void run();
+  private:
+    struct Operation
+    {
+      GxEPD* display;
+      void (*operation)(GxEPD& display, const void* p);
+      const void* p;
+      bool done;
+    };
+    static void _update(GxEPD& display, const void* p);
+    static void _onRefreshWait(void* p);
+    void _runNext();
+    bool _isActive(GxEPD* display);
+    Operation _operations[GxEPD_BusScheduler_MAX_OPERATIONS];
+    GxEPD* _active[GxEPD_BusScheduler_MAX_OPERATIONS]; // displays with running operation, nested
+    uint8_t _count, _active_count;
+};
+
+#endif
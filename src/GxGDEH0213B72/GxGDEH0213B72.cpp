@@ -61,44 +61,7 @@ GxGDEH0213B72::GxGDEH0213B72(GxIO& io, int8_t rst, int8_t busy) :
   _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
   _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEH0213B72::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEH0213B72_VISIBLE_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEH0213B72_VISIBLE_WIDTH - x - 1;
-      y = GxGDEH0213B72_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEH0213B72_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEH0213B72_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEH0213B72_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEH0213B72_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEH0213B72_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEH0213B72_WIDTH / 8, GxGDEH0213B72_PAGE_HEIGHT, &_current_page);
 }
 
 void GxGDEH0213B72::init(uint32_t serial_diag_bitrate)
@@ -108,8 +71,9 @@ void GxGDEH0213B72::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -128,33 +92,19 @@ void GxGDEH0213B72::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEH0213B72::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (uint16_t y = 0; y < GxGDEH0213B72_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDEH0213B72_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDEH0213B72_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEH0213B72_HEIGHT * (GxGDEH0213B72_WIDTH / 8), true);
   _writeCommand(0x26);
-  for (uint16_t y = 0; y < GxGDEH0213B72_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDEH0213B72_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDEH0213B72_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEH0213B72_HEIGHT * (GxGDEH0213B72_WIDTH / 8), true);
   _Update_Full();
   _PowerOff();
 }
@@ -167,6 +117,7 @@ void  GxGDEH0213B72::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, u
 
 void GxGDEH0213B72::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
   // bm_flip_y for normal display is rotated but avoids black boarder
@@ -182,19 +133,22 @@ void GxGDEH0213B72::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mod
     for (uint8_t command = 0x24; true; command = 0x26)
     { // leave both controller buffers equal
       _writeCommand(0x24);
-      for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       if (command == 0x26) break;
       _Update_Part();
@@ -209,19 +163,22 @@ void GxGDEH0213B72::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mod
     for (uint8_t command = 0x24; true; command = 0x26)
     { // leave both controller buffers equal
       _writeCommand(command);
-      for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       if (command == 0x26) break;
     }
@@ -232,24 +189,19 @@ void GxGDEH0213B72::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mod
 
 void GxGDEH0213B72::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
     _Init_Part(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B72_BUFFER_SIZE);
     _Update_Part();
     delay(GxGDEH0213B72_PU_DELAY);
     // update erase buffer
     _writeCommand(0x26);
-    for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B72_BUFFER_SIZE);
     delay(GxGDEH0213B72_PU_DELAY);
     _PowerOff();
   }
@@ -258,16 +210,10 @@ void GxGDEH0213B72::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _Init_Full(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B72_BUFFER_SIZE);
     // update erase buffer
     _writeCommand(0x26);
-    for (uint32_t i = 0; i < GxGDEH0213B72_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B72_BUFFER_SIZE);
     _Update_Full();
     _PowerOff();
   }
@@ -275,6 +221,7 @@ void GxGDEH0213B72::eraseDisplay(bool using_partial_update)
 
 void GxGDEH0213B72::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEH0213B72_WIDTH) return;
@@ -290,12 +237,7 @@ void GxGDEH0213B72::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x24);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH0213B72_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH0213B72_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   _Update_Part();
   delay(GxGDEH0213B72_PU_DELAY);
@@ -306,12 +248,7 @@ void GxGDEH0213B72::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x26);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH0213B72_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH0213B72_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   delay(GxGDEH0213B72_PU_DELAY);
 }
@@ -340,17 +277,13 @@ void GxGDEH0213B72::_writeToWindow(uint8_t command, uint16_t xs, uint16_t ys, ui
   _writeCommand(command);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 <= xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH0213B72_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH0213B72_WIDTH / 8) + xs / 8, xse_d8 - xs / 8 + 1, true);
   }
 }
 
 void GxGDEH0213B72::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -407,26 +340,46 @@ void GxGDEH0213B72::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
+void GxGDEH0213B72::_writeCommandData(uint8_t command, const uint8_t* data, uint16_t n)
+{
+  if (digitalRead(_busy))
+  {
+    String str = String("command 0x") + String(command, HEX);
+    _waitWhileBusy(str.c_str());
+  }
+  IO.writeCommandData(command, data, n);
+}
+
+void GxGDEH0213B72::_writeCommandData(uint8_t command, uint8_t data)
+{
+  _writeCommandData(command, &data, 1);
+}
+
 void GxGDEH0213B72::_writeData(const uint8_t* data, uint16_t n)
 {
   IO.startTransaction();
-  for (uint16_t i = 0; i < n; i++)
   {
-    IO.writeData(*data++);
+    GxIO_Burst burst(IO, true);
+    for (uint16_t i = 0; i < n; i++)
+    {
+      burst.write(*data++);
+    }
   }
   IO.endTransaction();
 }
 
-void GxGDEH0213B72::_waitWhileBusy(const char* comment)
+void GxGDEH0213B72::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (!digitalRead(_busy)) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 10000000)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -443,6 +396,7 @@ void GxGDEH0213B72::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEH0213B72::_setRamDataEntryMode(uint8_t em)
@@ -450,8 +404,7 @@ void GxGDEH0213B72::_setRamDataEntryMode(uint8_t em)
   const uint16_t xPixelsPar = GxGDEH0213B72_X_PIXELS - 1;
   const uint16_t yPixelsPar = GxGDEH0213B72_Y_PIXELS - 1;
   em = gx_uint16_min(em, 0x03);
-  _writeCommand(0x11);
-  _writeData(em);
+  _writeCommandData(0x11, em);
   switch (em)
   {
     case 0x00: // x decrease, y decrease
@@ -475,65 +428,66 @@ void GxGDEH0213B72::_setRamDataEntryMode(uint8_t em)
 
 void GxGDEH0213B72::_SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1)
 {
-  _writeCommand(0x44);
-  _writeData(Xstart);
-  _writeData(Xend);
-  _writeCommand(0x45);
-  _writeData(Ystart);
-  _writeData(Ystart1);
-  _writeData(Yend);
-  _writeData(Yend1);
+  {
+    const uint8_t data[] = {Xstart, Xend};
+    _writeCommandData(0x44, data, sizeof(data));
+  }
+  {
+    const uint8_t data[] = {Ystart, Ystart1, Yend, Yend1};
+    _writeCommandData(0x45, data, sizeof(data));
+  }
 }
 
 void GxGDEH0213B72::_SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1)
 {
-  _writeCommand(0x4e);
-  _writeData(addrX);
-  _writeCommand(0x4f);
-  _writeData(addrY);
-  _writeData(addrY1);
+  _writeCommandData(0x4e, addrX);
+  {
+    const uint8_t data[] = {addrY, addrY1};
+    _writeCommandData(0x4f, data, sizeof(data));
+  }
 }
 
 void GxGDEH0213B72::_PowerOn(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc0);
+  _writeCommandData(0x22, 0xc0);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOn");
+  _waitWhileBusy("_PowerOn", wait_power_on);
 }
 
 void GxGDEH0213B72::_PowerOff(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc3);
+  _writeCommandData(0x22, 0xc3);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOff");
+  _waitWhileBusy("_PowerOff", wait_power_off);
 }
 
 void GxGDEH0213B72::_InitDisplay(uint8_t em)
 {
-  _writeCommand(0x74); //set analog block control
-  _writeData(0x54);
-  _writeCommand(0x7E); //set digital block control
-  _writeData(0x3B);
-  _writeCommand(0x01); //Driver output control
-  _writeData(0xF9);    // (HEIGHT - 1) % 256
-  _writeData(0x00);    // (HEIGHT - 1) / 256
-  _writeData(0x00);
-  _writeCommand(0x3C); //BorderWavefrom
-  _writeData(0x03);
-  _writeCommand(0x2C); //VCOM Voltage
-  _writeData(0x70);    // NA ??
-  _writeCommand(0x03); //Gate Driving voltage Control
-  _writeData(0x15);    // 19V
-  _writeCommand(0x04); //Source Driving voltage Control
-  _writeData(0x41);    // VSH1 15V
-  _writeData(0xA8);    // VSH2 5V
-  _writeData(0x32);    // VSL -15V
-  _writeCommand(0x3A); //Dummy Line
-  _writeData(0x30);
-  _writeCommand(0x3B); //Gate time
-  _writeData(0x0A);
+  _writeCommandData(0x74, 0x54); // set analog block control
+  _writeCommandData(0x7E, 0x3B); // set digital block control
+  {
+    const uint8_t data[] =
+    {
+      0xF9, // (HEIGHT - 1) % 256
+      0x00, // (HEIGHT - 1) / 256
+      0x00
+    };
+    _writeCommandData(0x01, data, sizeof(data)); //Driver output control
+  }
+  _writeCommandData(0x3C, 0x03); // BorderWavefrom
+  _writeCommandData(0x2C, 0x70); // VCOM Voltage : NA ??
+  _writeCommandData(0x03, 0x15); // Gate Driving voltage Control : 19V
+  {
+    const uint8_t data[] =
+    {
+      0x41, // VSH1 15V
+      0xA8, // VSH2 5V
+      0x32 // VSL -15V
+    };
+    _writeCommandData(0x04, data, sizeof(data)); //Source Driving voltage Control
+  }
+  _writeCommandData(0x3A, 0x30); // Dummy Line
+  _writeCommandData(0x3B, 0x0A); // Gate time
   _setRamDataEntryMode(em);
 }
 
@@ -548,8 +502,7 @@ void GxGDEH0213B72::_Init_Full(uint8_t em)
 void GxGDEH0213B72::_Init_Part(uint8_t em)
 {
   _InitDisplay(em);
-  _writeCommand(0x2C); //VCOM Voltage
-  _writeData(0x26);    // NA ??
+  _writeCommandData(0x2C, 0x26); // VCOM Voltage : NA ??
   _writeCommand(0x32);
   _writeData(LUT_DATA_part, sizeof(LUT_DATA_part));
   _PowerOn();
@@ -557,18 +510,16 @@ void GxGDEH0213B72::_Init_Part(uint8_t em)
 
 void GxGDEH0213B72::_Update_Full(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc4);
+  _writeCommandData(0x22, 0xc4);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Full");
+  _waitWhileBusy("_Update_Full", wait_full_refresh);
 }
 
 void GxGDEH0213B72::_Update_Part(void)
 {
-  _writeCommand(0x22);
-  _writeData(0x04);
+  _writeCommandData(0x22, 0x04);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Part");
+  _waitWhileBusy("_Update_Part", wait_partial_refresh);
 }
 
 void GxGDEH0213B72::drawPaged(void (*drawCallback)(void))
@@ -582,16 +533,8 @@ void GxGDEH0213B72::drawPaged(void (*drawCallback)(void))
     for (_current_page = 0; _current_page < GxGDEH0213B72_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      for (int16_t y1 = 0; y1 < GxGDEH0213B72_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B72_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B72_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B72_PAGE_HEIGHT * (GxGDEH0213B72_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -611,16 +554,8 @@ void GxGDEH0213B72::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
     for (_current_page = 0; _current_page < GxGDEH0213B72_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxGDEH0213B72_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B72_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B72_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B72_PAGE_HEIGHT * (GxGDEH0213B72_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -640,16 +575,8 @@ void GxGDEH0213B72::drawPaged(void (*drawCallback)(const void*), const void* p)
     for (_current_page = 0; _current_page < GxGDEH0213B72_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxGDEH0213B72_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B72_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B72_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B72_PAGE_HEIGHT * (GxGDEH0213B72_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -669,16 +596,8 @@ void GxGDEH0213B72::drawPaged(void (*drawCallback)(const void*, const void*), co
     for (_current_page = 0; _current_page < GxGDEH0213B72_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      for (int16_t y1 = 0; y1 < GxGDEH0213B72_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B72_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B72_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p1, p2);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B72_PAGE_HEIGHT * (GxGDEH0213B72_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -728,7 +647,7 @@ void GxGDEH0213B72::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, ui
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback();
+        drawPage(drawCallback);
         uint16_t ys = yds % GxGDEH0213B72_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -759,7 +678,7 @@ void GxGDEH0213B72::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEH0213B72_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -790,7 +709,7 @@ void GxGDEH0213B72::drawPagedToWindow(void (*drawCallback)(const void*), uint16_
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEH0213B72_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -821,7 +740,7 @@ void GxGDEH0213B72::drawPagedToWindow(void (*drawCallback)(const void*, const vo
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p1, p2);
+        drawPage(drawCallback, p1, p2);
         uint16_t ys = yds % GxGDEH0213B72_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -834,20 +753,24 @@ void GxGDEH0213B72::drawPagedToWindow(void (*drawCallback)(const void*, const vo
 
 void GxGDEH0213B72::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _Init_Full(em);
   _writeCommand(0x24);
-  for (uint32_t y = 0; y < GxGDEH0213B72_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEH0213B72_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEH0213B72_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEH0213B72_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEH0213B72_WIDTH / 8 - 4) && (y > GxGDEH0213B72_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEH0213B72_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEH0213B72_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEH0213B72_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEH0213B72_WIDTH / 8 - 4) && (y > GxGDEH0213B72_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEH0213B72_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _Update_Full();
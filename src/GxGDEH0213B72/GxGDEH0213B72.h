@@ -45,7 +45,6 @@ class GxGDEH0213B72 : public GxEPD
 #else
     GxGDEH0213B72(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -82,6 +81,8 @@ class GxGDEH0213B72 : public GxEPD
     }
     void _writeToWindow(uint8_t command, uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h);
     void _writeData(uint8_t data);
+    void _writeCommandData(uint8_t command, const uint8_t* data, uint16_t n);
+    void _writeCommandData(uint8_t command, uint8_t data);
     void _writeCommand(uint8_t command);
     void _writeData(const uint8_t* data, uint16_t n);
     void _writeCommandData(const uint8_t* pCommandData, uint8_t datalen);
@@ -89,7 +90,7 @@ class GxGDEH0213B72 : public GxEPD
     void _SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1);
     void _PowerOn(void);
     void _PowerOff(void);
-    void _waitWhileBusy(const char* comment=0);
+    void _waitWhileBusy(const char* comment=0, busy_wait wait = wait_other);
     void _setRamDataEntryMode(uint8_t em);
     void _InitDisplay(uint8_t em);
     void _Init_Full(uint8_t em);
@@ -73,44 +73,7 @@ GxGDEH0213B73::GxGDEH0213B73(GxIO& io, int8_t rst, int8_t busy) :
   _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
   _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEH0213B73::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEH0213B73_VISIBLE_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEH0213B73_VISIBLE_WIDTH - x - 1;
-      y = GxGDEH0213B73_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEH0213B73_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEH0213B73_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEH0213B73_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEH0213B73_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEH0213B73_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEH0213B73_WIDTH / 8, GxGDEH0213B73_PAGE_HEIGHT, &_current_page);
 }
 
 void GxGDEH0213B73::init(uint32_t serial_diag_bitrate)
@@ -120,8 +83,9 @@ void GxGDEH0213B73::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_SSD168x);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -140,33 +104,19 @@ void GxGDEH0213B73::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEH0213B73::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (uint16_t y = 0; y < GxGDEH0213B73_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDEH0213B73_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDEH0213B73_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEH0213B73_HEIGHT * (GxGDEH0213B73_WIDTH / 8), true);
   _writeCommand(0x26);
-  for (uint16_t y = 0; y < GxGDEH0213B73_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDEH0213B73_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDEH0213B73_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEH0213B73_HEIGHT * (GxGDEH0213B73_WIDTH / 8), true);
   _Update_Full();
   _PowerOff();
 }
@@ -179,6 +129,7 @@ void  GxGDEH0213B73::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, u
 
 void GxGDEH0213B73::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
   // bm_flip_y for normal display is rotated but avoids black boarder
@@ -194,19 +145,22 @@ void GxGDEH0213B73::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mod
     for (uint8_t command = 0x24; true; command = 0x26)
     { // leave both controller buffers equal
       _writeCommand(0x24);
-      for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       if (command == 0x26) break;
       _Update_Part();
@@ -221,19 +175,22 @@ void GxGDEH0213B73::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mod
     for (uint8_t command = 0x24; true; command = 0x26)
     { // leave both controller buffers equal
       _writeCommand(command);
-      for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       if (command == 0x26) break;
     }
@@ -244,24 +201,19 @@ void GxGDEH0213B73::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mod
 
 void GxGDEH0213B73::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
     _Init_Part(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B73_BUFFER_SIZE);
     _Update_Part();
     delay(GxGDEH0213B73_PU_DELAY);
     // update erase buffer
     _writeCommand(0x26);
-    for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B73_BUFFER_SIZE);
     delay(GxGDEH0213B73_PU_DELAY);
     _PowerOff();
   }
@@ -270,16 +222,10 @@ void GxGDEH0213B73::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _Init_Full(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B73_BUFFER_SIZE);
     // update erase buffer
     _writeCommand(0x26);
-    for (uint32_t i = 0; i < GxGDEH0213B73_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH0213B73_BUFFER_SIZE);
     _Update_Full();
     _PowerOff();
   }
@@ -287,6 +233,7 @@ void GxGDEH0213B73::eraseDisplay(bool using_partial_update)
 
 void GxGDEH0213B73::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEH0213B73_WIDTH) return;
@@ -302,12 +249,7 @@ void GxGDEH0213B73::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x24);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH0213B73_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH0213B73_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   _Update_Part();
   delay(GxGDEH0213B73_PU_DELAY);
@@ -318,12 +260,7 @@ void GxGDEH0213B73::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x26);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH0213B73_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH0213B73_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   delay(GxGDEH0213B73_PU_DELAY);
 }
@@ -352,17 +289,13 @@ void GxGDEH0213B73::_writeToWindow(uint8_t command, uint16_t xs, uint16_t ys, ui
   _writeCommand(command);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 <= xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH0213B73_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH0213B73_WIDTH / 8) + xs / 8, xse_d8 - xs / 8 + 1, true);
   }
 }
 
 void GxGDEH0213B73::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -404,6 +337,18 @@ void GxGDEH0213B73::powerDown()
   _PowerOff();
 }
 
+bool GxGDEH0213B73::verifySPIFrequency()
+{
+  const uint8_t pattern[] = {0x55, 0xAA, 0x33, 0xCC, 0x0F, 0xF0, 0x00, 0xFF};
+  _InitDisplay(0x03); // x increase, y increase : normal mode
+  _writeCommandData(0x24, pattern, sizeof(pattern)); // start of b/w RAM
+  _SetRamPointer(0x00, 0x00, 0x00);
+  if (digitalRead(_busy)) _waitWhileBusy("verifySPIFrequency");
+  bool ok = verifyRamReadback(IO, pattern, sizeof(pattern));
+  if (_diag_enabled && !ok) Serial.println("verifySPIFrequency failed, SPI clock set to 4MHz");
+  return ok;
+}
+
 void GxGDEH0213B73::_writeCommand(uint8_t command)
 {
   if (digitalRead(_busy))
@@ -419,26 +364,46 @@ void GxGDEH0213B73::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
+void GxGDEH0213B73::_writeCommandData(uint8_t command, const uint8_t* data, uint16_t n)
+{
+  if (digitalRead(_busy))
+  {
+    String str = String("command 0x") + String(command, HEX);
+    _waitWhileBusy(str.c_str());
+  }
+  IO.writeCommandData(command, data, n);
+}
+
+void GxGDEH0213B73::_writeCommandData(uint8_t command, uint8_t data)
+{
+  _writeCommandData(command, &data, 1);
+}
+
 void GxGDEH0213B73::_writeData(const uint8_t* data, uint16_t n)
 {
   IO.startTransaction();
-  for (uint16_t i = 0; i < n; i++)
   {
-    IO.writeData(*data++);
+    GxIO_Burst burst(IO, true);
+    for (uint16_t i = 0; i < n; i++)
+    {
+      burst.write(*data++);
+    }
   }
   IO.endTransaction();
 }
 
-void GxGDEH0213B73::_waitWhileBusy(const char* comment)
+void GxGDEH0213B73::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (!digitalRead(_busy)) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 10000000)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -455,6 +420,7 @@ void GxGDEH0213B73::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEH0213B73::_setRamDataEntryMode(uint8_t em)
@@ -462,8 +428,7 @@ void GxGDEH0213B73::_setRamDataEntryMode(uint8_t em)
   const uint16_t xPixelsPar = GxGDEH0213B73_X_PIXELS - 1;
   const uint16_t yPixelsPar = GxGDEH0213B73_Y_PIXELS - 1;
   em = gx_uint16_min(em, 0x03);
-  _writeCommand(0x11);
-  _writeData(em);
+  _writeCommandData(0x11, em);
   switch (em)
   {
     case 0x00: // x decrease, y decrease
@@ -487,80 +452,85 @@ void GxGDEH0213B73::_setRamDataEntryMode(uint8_t em)
 
 void GxGDEH0213B73::_SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1)
 {
-  _writeCommand(0x44);
-  _writeData(Xstart);
-  _writeData(Xend);
-  _writeCommand(0x45);
-  _writeData(Ystart);
-  _writeData(Ystart1);
-  _writeData(Yend);
-  _writeData(Yend1);
+  {
+    const uint8_t data[] = {Xstart, Xend};
+    _writeCommandData(0x44, data, sizeof(data));
+  }
+  {
+    const uint8_t data[] = {Ystart, Ystart1, Yend, Yend1};
+    _writeCommandData(0x45, data, sizeof(data));
+  }
 }
 
 void GxGDEH0213B73::_SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1)
 {
-  _writeCommand(0x4e);
-  _writeData(addrX);
-  _writeCommand(0x4f);
-  _writeData(addrY);
-  _writeData(addrY1);
+  _writeCommandData(0x4e, addrX);
+  {
+    const uint8_t data[] = {addrY, addrY1};
+    _writeCommandData(0x4f, data, sizeof(data));
+  }
 }
 
 void GxGDEH0213B73::_PowerOn(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc0);
+  _writeCommandData(0x22, 0xc0);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOn");
+  _waitWhileBusy("_PowerOn", wait_power_on);
 }
 
 void GxGDEH0213B73::_PowerOff(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc3);
+  _writeCommandData(0x22, 0xc3);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOff");
+  _waitWhileBusy("_PowerOff", wait_power_off);
 }
 
 void GxGDEH0213B73::_InitDisplay(uint8_t em)
 {
-  _writeCommand(0x74); //set analog block control
-  _writeData(0x54);
-  _writeCommand(0x7E); //set digital block control
-  _writeData(0x3B);
-  _writeCommand(0x01); //Driver output control
-  _writeData(0xF9);
-  _writeData(0x00);
-  _writeData(0x00);
-  _writeCommand(0x11); //data entry mode
-  _writeData(0x01);
-  _writeCommand(0x44); //set Ram-X address start/end position
-  _writeData(0x00);
-  _writeData(0x0F);    //0x0C-->(15+1)*8=128
-  _writeCommand(0x45); //set Ram-Y address start/end position
-  _writeData(0xF9);   //0xF9-->(249+1)=250
-  _writeData(0x00);
-  _writeData(0x00);
-  _writeData(0x00);
-  _writeCommand(0x3C); //BorderWavefrom
-  _writeData(0x03);
-  _writeCommand(0x2C); //VCOM Voltage
-  _writeData(0x50);    //
-  _writeCommand(0x03); //Gate Driving voltage Control
-  _writeData(0x15);    // 19V
-  _writeCommand(0x04); //Source Driving voltage Control
-  _writeData(0x41);    // VSH1 15V
-  _writeData(0xA8);    // VSH2 5V
-  _writeData(0x32);    // VSL -15V
-  _writeCommand(0x3A); //Dummy Line
-  _writeData(0x2C);
-  _writeCommand(0x3B); //Gate time
-  _writeData(0x0B);
-  _writeCommand(0x4E); // set RAM x address count to 0;
-  _writeData(0x00);
-  _writeCommand(0x4F); // set RAM y address count to 0X127;
-  _writeData(0xF9);
-  _writeData(0x00);
+  _writeCommandData(0x74, 0x54); // set analog block control
+  _writeCommandData(0x7E, 0x3B); // set digital block control
+  {
+    const uint8_t data[] = {0xF9, 0x00, 0x00};
+    _writeCommandData(0x01, data, sizeof(data)); //Driver output control
+  }
+  _writeCommandData(0x11, 0x01); // data entry mode
+  {
+    const uint8_t data[] =
+    {
+      0x00,
+      0x0F //0x0C-->(15+1)*8=128
+    };
+    _writeCommandData(0x44, data, sizeof(data)); //set Ram-X address start/end position
+  }
+  {
+    const uint8_t data[] =
+    {
+      0xF9, //0xF9-->(249+1)=250
+      0x00,
+      0x00,
+      0x00
+    };
+    _writeCommandData(0x45, data, sizeof(data)); //set Ram-Y address start/end position
+  }
+  _writeCommandData(0x3C, 0x03); // BorderWavefrom
+  _writeCommandData(0x2C, 0x50); // VCOM Voltage : 
+  _writeCommandData(0x03, 0x15); // Gate Driving voltage Control : 19V
+  {
+    const uint8_t data[] =
+    {
+      0x41, // VSH1 15V
+      0xA8, // VSH2 5V
+      0x32 // VSL -15V
+    };
+    _writeCommandData(0x04, data, sizeof(data)); //Source Driving voltage Control
+  }
+  _writeCommandData(0x3A, 0x2C); // Dummy Line
+  _writeCommandData(0x3B, 0x0B); // Gate time
+  _writeCommandData(0x4E, 0x00); // set RAM x address count to 0;
+  {
+    const uint8_t data[] = {0xF9, 0x00};
+    _writeCommandData(0x4F, data, sizeof(data)); // set RAM y address count to 0X127;
+  }
   _setRamDataEntryMode(em);
 }
 
@@ -575,8 +545,7 @@ void GxGDEH0213B73::_Init_Full(uint8_t em)
 void GxGDEH0213B73::_Init_Part(uint8_t em)
 {
   _InitDisplay(em);
-  _writeCommand(0x2C); //VCOM Voltage
-  _writeData(0x26);    // NA ??
+  _writeCommandData(0x2C, 0x26); // VCOM Voltage : NA ??
   _writeCommand(0x32);
   _writeData(LUT_DATA_part, sizeof(LUT_DATA_part));
   // the demo code uses Mode 2 with Ping Pong (P 29), doesn't work with GxEPD
@@ -593,19 +562,17 @@ void GxGDEH0213B73::_Init_Part(uint8_t em)
 
 void GxGDEH0213B73::_Update_Full(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc7);
+  _writeCommandData(0x22, 0xc7);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Full");
+  _waitWhileBusy("_Update_Full", wait_full_refresh);
 }
 
 void GxGDEH0213B73::_Update_Part(void)
 {
-  _writeCommand(0x22);
-  // _writeData(0x0C); // the demo code uses Mode 2 with Ping Pong
-  _writeData(0x04); // use Mode 1 for GxEPD
+  //_writeCommandData(0x22, 0x0C); // the demo code uses Mode 2 with Ping Pong
+  _writeCommandData(0x22, 0x04); // use Mode 1 for GxEPD
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Part");
+  _waitWhileBusy("_Update_Part", wait_partial_refresh);
 }
 
 void GxGDEH0213B73::drawPaged(void (*drawCallback)(void))
@@ -619,16 +586,8 @@ void GxGDEH0213B73::drawPaged(void (*drawCallback)(void))
     for (_current_page = 0; _current_page < GxGDEH0213B73_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      for (int16_t y1 = 0; y1 < GxGDEH0213B73_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B73_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B73_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B73_PAGE_HEIGHT * (GxGDEH0213B73_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -648,16 +607,8 @@ void GxGDEH0213B73::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
     for (_current_page = 0; _current_page < GxGDEH0213B73_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxGDEH0213B73_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B73_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B73_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B73_PAGE_HEIGHT * (GxGDEH0213B73_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -677,16 +628,8 @@ void GxGDEH0213B73::drawPaged(void (*drawCallback)(const void*), const void* p)
     for (_current_page = 0; _current_page < GxGDEH0213B73_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxGDEH0213B73_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B73_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B73_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B73_PAGE_HEIGHT * (GxGDEH0213B73_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -706,16 +649,8 @@ void GxGDEH0213B73::drawPaged(void (*drawCallback)(const void*, const void*), co
     for (_current_page = 0; _current_page < GxGDEH0213B73_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      for (int16_t y1 = 0; y1 < GxGDEH0213B73_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEH0213B73_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEH0213B73_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p1, p2);
+      IO.writeDataTransactionAsync(_buffer, GxGDEH0213B73_PAGE_HEIGHT * (GxGDEH0213B73_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x26) break;
@@ -765,7 +700,7 @@ void GxGDEH0213B73::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, ui
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback();
+        drawPage(drawCallback);
         uint16_t ys = yds % GxGDEH0213B73_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -796,7 +731,7 @@ void GxGDEH0213B73::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEH0213B73_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -827,7 +762,7 @@ void GxGDEH0213B73::drawPagedToWindow(void (*drawCallback)(const void*), uint16_
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEH0213B73_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -858,7 +793,7 @@ void GxGDEH0213B73::drawPagedToWindow(void (*drawCallback)(const void*, const vo
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p1, p2);
+        drawPage(drawCallback, p1, p2);
         uint16_t ys = yds % GxGDEH0213B73_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -871,20 +806,24 @@ void GxGDEH0213B73::drawPagedToWindow(void (*drawCallback)(const void*, const vo
 
 void GxGDEH0213B73::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _Init_Full(em);
   _writeCommand(0x24);
-  for (uint32_t y = 0; y < GxGDEH0213B73_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEH0213B73_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEH0213B73_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEH0213B73_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEH0213B73_WIDTH / 8 - 4) && (y > GxGDEH0213B73_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEH0213B73_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEH0213B73_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEH0213B73_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEH0213B73_WIDTH / 8 - 4) && (y > GxGDEH0213B73_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEH0213B73_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _Update_Full();
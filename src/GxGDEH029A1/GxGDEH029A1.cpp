@@ -49,44 +49,7 @@ GxGDEH029A1::GxGDEH029A1(GxIO& io, int8_t rst, int8_t busy) :
   _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
   _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEH029A1::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEH029A1_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEH029A1_WIDTH - x - 1;
-      y = GxGDEH029A1_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEH029A1_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEH029A1_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEH029A1_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEH029A1_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEH029A1_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEH029A1_WIDTH / 8, GxGDEH029A1_PAGE_HEIGHT, &_current_page);
 }
 
 void GxGDEH029A1::init(uint32_t serial_diag_bitrate)
@@ -96,8 +59,9 @@ void GxGDEH029A1::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -116,23 +80,17 @@ void GxGDEH029A1::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEH029A1::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (uint16_t y = 0; y < GxGDEH029A1_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDEH029A1_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDEH029A1_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEH029A1_HEIGHT * (GxGDEH029A1_WIDTH / 8), true);
   _Update_Full();
   _PowerOff();
 }
@@ -145,6 +103,7 @@ void  GxGDEH029A1::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 
 void GxGDEH029A1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
   // bm_flip_x for normal display (bm_flip_y would be rotated)
@@ -158,37 +117,43 @@ void GxGDEH029A1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     _using_partial_mode = true; // remember
     _Init_Part(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _Update_Part();
     delay(GxGDEH029A1_PU_DELAY);
     // update erase buffer
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     delay(GxGDEH029A1_PU_DELAY);
     _PowerOff();
@@ -198,19 +163,22 @@ void GxGDEH029A1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     _using_partial_mode = false; // remember
     _Init_Full(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _Update_Full();
     _PowerOff();
@@ -219,24 +187,19 @@ void GxGDEH029A1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 
 void GxGDEH029A1::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
     _Init_Part(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029A1_BUFFER_SIZE);
     _Update_Part();
     delay(GxGDEH029A1_PU_DELAY);
     // update erase buffer
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029A1_BUFFER_SIZE);
     delay(GxGDEH029A1_PU_DELAY);
     _PowerOff();
   }
@@ -245,10 +208,7 @@ void GxGDEH029A1::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _Init_Full(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEH029A1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029A1_BUFFER_SIZE);
     _Update_Full();
     _PowerOff();
   }
@@ -256,6 +216,7 @@ void GxGDEH029A1::eraseDisplay(bool using_partial_update)
 
 void GxGDEH029A1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEH029A1_WIDTH) return;
@@ -271,12 +232,7 @@ void GxGDEH029A1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   _writeCommand(0x24);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH029A1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH029A1_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   _Update_Part();
   delay(GxGDEH029A1_PU_DELAY);
@@ -287,12 +243,7 @@ void GxGDEH029A1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   _writeCommand(0x24);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH029A1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH029A1_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   delay(GxGDEH029A1_PU_DELAY);
 }
@@ -321,17 +272,13 @@ void GxGDEH029A1::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   _writeCommand(0x24);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 <= xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH029A1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEH029A1_WIDTH / 8) + xs / 8, xse_d8 - xs / 8 + 1, true);
   }
 }
 
 void GxGDEH029A1::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -389,32 +336,37 @@ void GxGDEH029A1::_writeData(uint8_t data)
 }
 
 void GxGDEH029A1::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen)
+{
+  _writeCommandData(pCommandData[0], pCommandData + 1, datalen - 1); // command is first byte
+}
+
+void GxGDEH029A1::_writeCommandData(uint8_t command, const uint8_t* data, uint16_t n)
 {
   if (digitalRead(_busy))
   {
-    String str = String("command 0x") + String(pCommandData[0], HEX);
+    String str = String("command 0x") + String(command, HEX);
     _waitWhileBusy(str.c_str());
   }
-  IO.startTransaction();
-  IO.writeCommand(*pCommandData++);
-  for (uint8_t i = 0; i < datalen - 1; i++)	// sub the command
-  {
-    IO.writeData(*pCommandData++);
-  }
-  IO.endTransaction();
+  IO.writeCommandData(command, data, n);
+}
 
+void GxGDEH029A1::_writeCommandData(uint8_t command, uint8_t data)
+{
+  _writeCommandData(command, &data, 1);
 }
 
-void GxGDEH029A1::_waitWhileBusy(const char* comment)
+void GxGDEH029A1::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (!digitalRead(_busy)) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 10000000)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -431,6 +383,7 @@ void GxGDEH029A1::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEH029A1::_setRamDataEntryMode(uint8_t em)
@@ -438,8 +391,7 @@ void GxGDEH029A1::_setRamDataEntryMode(uint8_t em)
   const uint16_t xPixelsPar = GxGDEH029A1_X_PIXELS - 1;
   const uint16_t yPixelsPar = GxGDEH029A1_Y_PIXELS - 1;
   em = gx_uint16_min(em, 0x03);
-  _writeCommand(0x11);
-  _writeData(em);
+  _writeCommandData(0x11, em);
   switch (em)
   {
     case 0x00: // x decrease, y decrease
@@ -463,39 +415,37 @@ void GxGDEH029A1::_setRamDataEntryMode(uint8_t em)
 
 void GxGDEH029A1::_SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1)
 {
-  _writeCommand(0x44);
-  _writeData(Xstart);
-  _writeData(Xend);
-  _writeCommand(0x45);
-  _writeData(Ystart);
-  _writeData(Ystart1);
-  _writeData(Yend);
-  _writeData(Yend1);
+  {
+    const uint8_t data[] = {Xstart, Xend};
+    _writeCommandData(0x44, data, sizeof(data));
+  }
+  {
+    const uint8_t data[] = {Ystart, Ystart1, Yend, Yend1};
+    _writeCommandData(0x45, data, sizeof(data));
+  }
 }
 
 void GxGDEH029A1::_SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1)
 {
-  _writeCommand(0x4e);
-  _writeData(addrX);
-  _writeCommand(0x4f);
-  _writeData(addrY);
-  _writeData(addrY1);
+  _writeCommandData(0x4e, addrX);
+  {
+    const uint8_t data[] = {addrY, addrY1};
+    _writeCommandData(0x4f, data, sizeof(data));
+  }
 }
 
 void GxGDEH029A1::_PowerOn(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc0);
+  _writeCommandData(0x22, 0xc0);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOn");
+  _waitWhileBusy("_PowerOn", wait_power_on);
 }
 
 void GxGDEH029A1::_PowerOff(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc3);
+  _writeCommandData(0x22, 0xc3);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOff");
+  _waitWhileBusy("_PowerOff", wait_power_off);
 }
 
 void GxGDEH029A1::_InitDisplay(uint8_t em)
@@ -524,19 +474,17 @@ void GxGDEH029A1::_Init_Part(uint8_t em)
 
 void GxGDEH029A1::_Update_Full(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc4);
+  _writeCommandData(0x22, 0xc4);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Full");
+  _waitWhileBusy("_Update_Full", wait_full_refresh);
   _writeCommand(0xff);
 }
 
 void GxGDEH029A1::_Update_Part(void)
 {
-  _writeCommand(0x22);
-  _writeData(0x04);
+  _writeCommandData(0x22, 0x04);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Part");
+  _waitWhileBusy("_Update_Part", wait_partial_refresh);
   _writeCommand(0xff);
 }
 
@@ -549,16 +497,8 @@ void GxGDEH029A1::drawPaged(void (*drawCallback)(void))
   for (_current_page = 0; _current_page < GxGDEH029A1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEH029A1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029A1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029A1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_buffer, GxGDEH029A1_PAGE_HEIGHT * (GxGDEH029A1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -574,16 +514,8 @@ void GxGDEH029A1::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   for (_current_page = 0; _current_page < GxGDEH029A1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEH029A1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029A1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029A1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEH029A1_PAGE_HEIGHT * (GxGDEH029A1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -599,16 +531,8 @@ void GxGDEH029A1::drawPaged(void (*drawCallback)(const void*), const void* p)
   for (_current_page = 0; _current_page < GxGDEH029A1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEH029A1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029A1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029A1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEH029A1_PAGE_HEIGHT * (GxGDEH029A1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -624,16 +548,8 @@ void GxGDEH029A1::drawPaged(void (*drawCallback)(const void*, const void*), cons
   for (_current_page = 0; _current_page < GxGDEH029A1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEH029A1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029A1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029A1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_buffer, GxGDEH029A1_PAGE_HEIGHT * (GxGDEH029A1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -679,7 +595,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -694,7 +610,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -722,7 +638,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -737,7 +653,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -765,7 +681,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -780,7 +696,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -808,7 +724,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(const void*, const void
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -823,7 +739,7 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(const void*, const void
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEH029A1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -835,20 +751,24 @@ void GxGDEH029A1::drawPagedToWindow(void (*drawCallback)(const void*, const void
 
 void GxGDEH029A1::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _Init_Full(em);
   _writeCommand(0x24);
-  for (uint32_t y = 0; y < GxGDEH029A1_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEH029A1_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEH029A1_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEH029A1_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEH029A1_WIDTH / 8 - 4) && (y > GxGDEH029A1_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEH029A1_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEH029A1_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEH029A1_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEH029A1_WIDTH / 8 - 4) && (y > GxGDEH029A1_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEH029A1_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _Update_Full();
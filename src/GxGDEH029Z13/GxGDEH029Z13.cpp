@@ -29,53 +29,7 @@ GxGDEH029Z13::GxGDEH029Z13(GxIO& io, int8_t rst, int8_t busy)
     _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEH029Z13::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEH029Z13_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEH029Z13_WIDTH - x - 1;
-      y = GxGDEH029Z13_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEH029Z13_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEH029Z13_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEH029Z13_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEH029Z13_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEH029Z13_WIDTH / 8;
-  }
-
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+  setBufferLayout(buffer_3c, _black_buffer, _red_buffer, sizeof(_black_buffer), GxGDEH029Z13_WIDTH / 8, GxGDEH029Z13_PAGE_HEIGHT, &_current_page);
 }
 
 
@@ -86,8 +40,9 @@ void GxGDEH029Z13::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_UC8151D);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -113,25 +68,21 @@ void GxGDEH029Z13::fillScreen(uint16_t color)
     _black_buffer[x] = black;
     _red_buffer[x] = red;
   }
+  bufferFilled(color);
 }
 
 void GxGDEH029Z13::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _black_buffer, sizeof(_black_buffer), 0, GxGDEH029Z13_BUFFER_SIZE, true);
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_red_buffer)) ? ~_red_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _red_buffer, sizeof(_red_buffer), 0, GxGDEH029Z13_BUFFER_SIZE, true);
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -143,51 +94,60 @@ void  GxGDEH029Z13::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEH029Z13::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size)
 {
+  invalidateShadow();
   drawPicture(black_bitmap, red_bitmap, black_size, red_size, bm_invert_red);
 }
 
 void GxGDEH029Z13::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
   {
-    uint8_t data = 0xFF; // white is 0xFF on device
-    if (i < black_size)
+    GxIO_Burst burst(IO);
+    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
     {
+      uint8_t data = 0xFF; // white is 0xFF on device
+      if (i < black_size)
+      {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&black_bitmap[i]);
+        data = pgm_read_byte(&black_bitmap[i]);
 #else
-      data = black_bitmap[i];
+        data = black_bitmap[i];
 #endif
-      if (mode & bm_invert) data = ~data;
+        if (mode & bm_invert) data = ~data;
+      }
+      burst.write(data);
     }
-    _writeData(data);
   }
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
   {
-    uint8_t data = 0xFF; // white is 0xFF on device
-    if (i < red_size)
+    GxIO_Burst burst(IO);
+    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
     {
+      uint8_t data = 0xFF; // white is 0xFF on device
+      if (i < red_size)
+      {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&red_bitmap[i]);
+        data = pgm_read_byte(&red_bitmap[i]);
 #else
-      data = red_bitmap[i];
+        data = red_bitmap[i];
 #endif
-      if (mode & bm_invert_red) data = ~data;
+        if (mode & bm_invert_red) data = ~data;
+      }
+      burst.write(data);
     }
-    _writeData(data);
   }
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPicture");
+  _waitWhileBusy("drawPicture", wait_refresh);
   _sleep();
 }
 
 void GxGDEH029Z13::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   // example bitmaps are normal on b/w, but inverted on red
   if (mode & bm_default) mode |= bm_normal;
@@ -198,28 +158,28 @@ void GxGDEH029Z13::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEH029Z13_WIDTH - 1, GxGDEH029Z13_HEIGHT - 1);
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029Z13_BUFFER_SIZE); // white is 0xFF on device
     if (!usePartialUpdateWindow) IO.writeCommandTransaction(0x92); // partial out
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     if (usePartialUpdateWindow) IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -227,33 +187,34 @@ void GxGDEH029Z13::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029Z13_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEH029Z13::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -262,18 +223,12 @@ void GxGDEH029Z13::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEH029Z13_WIDTH - 1, GxGDEH029Z13_HEIGHT - 1);
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029Z13_BUFFER_SIZE * 2); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029Z13_BUFFER_SIZE); // white is 0xFF on device
     if (!usePartialUpdateWindow) IO.writeCommandTransaction(0x92); // partial out
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     if (usePartialUpdateWindow) IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -281,23 +236,18 @@ void GxGDEH029Z13::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029Z13_BUFFER_SIZE * 2); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEH029Z13_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEH029Z13::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation)
   {
@@ -334,37 +284,28 @@ void GxGDEH029Z13::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   IO.writeCommandTransaction(0x10);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    writeBufferData(IO, _black_buffer, sizeof(_black_buffer), y1 * (GxGDEH029Z13_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
   }
   IO.writeCommandTransaction(0x13);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    writeBufferData(IO, _red_buffer, sizeof(_red_buffer), y1 * (GxGDEH029Z13_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
   }
   if (!usePartialUpdateWindow) IO.writeCommandTransaction(0x92); // partial out
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("updateWindow");
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
   if (usePartialUpdateWindow) IO.writeCommandTransaction(0x92); // partial out
   delay(GxGDEH029Z13_PU_DELAY); // don't stress this display
 }
 
 void GxGDEH029Z13::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   delay(GxGDEH029Z13_PU_DELAY); // don't stress this display
 }
 
@@ -411,22 +352,12 @@ void GxGDEH029Z13::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   IO.writeCommandTransaction(0x10);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    writeBufferData(IO, _black_buffer, sizeof(_black_buffer), y1 * (GxGDEH029Z13_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
   }
   IO.writeCommandTransaction(0x13);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data); // white is 0xFF on device
-    }
+    writeBufferData(IO, _red_buffer, sizeof(_red_buffer), y1 * (GxGDEH029Z13_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
   }
   IO.writeCommandTransaction(0x92); // partial out
 }
@@ -441,16 +372,21 @@ uint16_t GxGDEH029Z13::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 {
   x &= 0xFFF8; // byte boundary
   xe = (xe - 1) | 0x0007; // byte boundary - 1
-  IO.writeCommandTransaction(0x90); // partial window
-  //IO.writeDataTransaction(x / 256);
-  IO.writeDataTransaction(x % 256);
-  //IO.writeDataTransaction(xe / 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  IO.writeDataTransaction(0x01); // don't see any difference
+  {
+    const uint8_t data[] =
+    {
+      //uint8_t(x / 256),
+      uint8_t(x % 256),
+      //uint8_t(xe / 256),
+      uint8_t(xe % 256),
+      uint8_t(y / 256),
+      uint8_t(y % 256),
+      uint8_t(ye / 256),
+      uint8_t(ye % 256),
+      0x01 // don't see any difference
+    };
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   //IO.writeDataTransaction(0x00); // don't see any difference
   return (7 + xe - x) / 8; // number of bytes to transfer per line
 }
@@ -465,16 +401,18 @@ void GxGDEH029Z13::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void GxGDEH029Z13::_waitWhileBusy(const char* comment)
+void GxGDEH029Z13::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 20000000) // >14.9s !
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -491,6 +429,7 @@ void GxGDEH029Z13::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEH029Z13::_wakeUp()
@@ -501,28 +440,25 @@ void GxGDEH029Z13::_wakeUp()
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
   }
-  _writeCommand(0x00); // panel setting
-  _writeData(0x8f);    // LUT from OTP
-  _writeCommand(0x61); // resolution setting
-  _writeData (GxGDEH029Z13_WIDTH);
-  _writeData (GxGDEH029Z13_HEIGHT >> 8);
-  _writeData (GxGDEH029Z13_HEIGHT & 0xFF);
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x77);    // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  IO.writeCommandData(0x00, 0x8f); // panel setting : LUT from OTP
+  {
+    const uint8_t data[] = {GxGDEH029Z13_WIDTH, uint8_t(GxGDEH029Z13_HEIGHT >> 8), uint8_t(GxGDEH029Z13_HEIGHT & 0xFF)};
+    IO.writeCommandData(0x61, data, sizeof(data)); // resolution setting
+  }
+  IO.writeCommandData(0x50, 0x77); // VCOM AND DATA INTERVAL SETTING : WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   _writeCommand(0x04);
-  _waitWhileBusy("_wakeUp Power On");
+  _waitWhileBusy("_wakeUp Power On", wait_power_on);
 }
 
 void GxGDEH029Z13::_sleep(void)
 {
   _writeCommand(0x02);      //power off
-  _waitWhileBusy("_sleep Power Off");
+  _waitWhileBusy("_sleep Power Off", wait_power_off);
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData (0xa5);
+    IO.writeCommandData(0x07, 0xa5); // deep sleep
   }
 }
 
@@ -535,35 +471,19 @@ void GxGDEH029Z13::drawPaged(void (*drawCallback)(void))
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -576,35 +496,19 @@ void GxGDEH029Z13::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -617,35 +521,19 @@ void GxGDEH029Z13::drawPaged(void (*drawCallback)(const void*), const void* p)
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -658,35 +546,19 @@ void GxGDEH029Z13::drawPaged(void (*drawCallback)(const void*, const void*), con
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEH029Z13_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEH029Z13_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEH029Z13_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEH029Z13_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEH029Z13_PAGE_HEIGHT * (GxGDEH029Z13_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -728,14 +600,14 @@ void GxGDEH029Z13::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEH029Z13_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEH029Z13_PU_DELAY); // don't stress this display
 }
 
@@ -756,14 +628,14 @@ void GxGDEH029Z13::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEH029Z13_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEH029Z13_PU_DELAY); // don't stress this display
 }
 
@@ -784,14 +656,14 @@ void GxGDEH029Z13::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEH029Z13_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEH029Z13_PU_DELAY); // don't stress this display
 }
 
@@ -812,41 +684,42 @@ void GxGDEH029Z13::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEH029Z13_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEH029Z13_PU_DELAY); // don't stress this display
 }
 
 void GxGDEH029Z13::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t y = 0; y < GxGDEH029Z13_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEH029Z13_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEH029Z13_HEIGHT; y++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEH029Z13_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEH029Z13_WIDTH / 8 - 4) && (y > GxGDEH029Z13_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEH029Z13_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEH029Z13_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEH029Z13_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEH029Z13_WIDTH / 8 - 4) && (y > GxGDEH029Z13_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEH029Z13_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEH029Z13_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEH029Z13_BUFFER_SIZE); // white is 0xFF on device
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
@@ -49,44 +49,7 @@ GxGDEP015OC1::GxGDEP015OC1(GxIO& io, int8_t rst, int8_t busy) :
   _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
   _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEP015OC1::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEP015OC1_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEP015OC1_WIDTH - x - 1;
-      y = GxGDEP015OC1_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEP015OC1_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEP015OC1_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEP015OC1_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEP015OC1_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEP015OC1_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEP015OC1_WIDTH / 8, GxGDEP015OC1_PAGE_HEIGHT, &_current_page);
 }
 
 void GxGDEP015OC1::init(uint32_t serial_diag_bitrate)
@@ -96,8 +59,9 @@ void GxGDEP015OC1::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -116,23 +80,17 @@ void GxGDEP015OC1::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEP015OC1::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _Init_Full(0x03);
   _writeCommand(0x24);
-  for (uint16_t y = 0; y < GxGDEP015OC1_HEIGHT; y++)
-  {
-    for (uint16_t x = 0; x < GxGDEP015OC1_WIDTH / 8; x++)
-    {
-      uint16_t idx = y * (GxGDEP015OC1_WIDTH / 8) + x;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEP015OC1_HEIGHT * (GxGDEP015OC1_WIDTH / 8), true);
   _Update_Full();
   _PowerOff();
 }
@@ -145,6 +103,7 @@ void  GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
   // bm_flip_x for normal display (bm_flip_y would be rotated)
@@ -158,37 +117,43 @@ void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = true; // remember
     _Init_Part(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _Update_Part();
     delay(GxGDEP015OC1_PU_DELAY);
     // update erase buffer
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     delay(GxGDEP015OC1_PU_DELAY);
     _PowerOff();
@@ -198,19 +163,22 @@ void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _Init_Full(ram_entry_mode);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _Update_Full();
     _PowerOff();
@@ -219,24 +187,19 @@ void GxGDEP015OC1::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
 
 void GxGDEP015OC1::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
     _using_partial_mode = true; // remember
     _Init_Part(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEP015OC1_BUFFER_SIZE);
     _Update_Part();
     delay(GxGDEP015OC1_PU_DELAY);
     // update erase buffer
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEP015OC1_BUFFER_SIZE);
     delay(GxGDEP015OC1_PU_DELAY);
   }
   else
@@ -244,10 +207,7 @@ void GxGDEP015OC1::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _Init_Full(0x01);
     _writeCommand(0x24);
-    for (uint32_t i = 0; i < GxGDEP015OC1_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEP015OC1_BUFFER_SIZE);
     _Update_Full();
     _PowerOff();
   }
@@ -255,6 +215,7 @@ void GxGDEP015OC1::eraseDisplay(bool using_partial_update)
 
 void GxGDEP015OC1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEP015OC1_WIDTH) return;
@@ -270,12 +231,7 @@ void GxGDEP015OC1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x24);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEP015OC1_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   _Update_Part();
   delay(GxGDEP015OC1_PU_DELAY);
@@ -286,12 +242,7 @@ void GxGDEP015OC1::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _writeCommand(0x24);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_d8; x1 <= xe_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEP015OC1_WIDTH / 8) + xs_d8, xe_d8 - xs_d8 + 1, true);
   }
   delay(GxGDEP015OC1_PU_DELAY);
 }
@@ -320,17 +271,13 @@ void GxGDEP015OC1::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   _writeCommand(0x24);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 <= xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      _writeData(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEP015OC1_WIDTH / 8) + xs / 8, xse_d8 - xs / 8 + 1, true);
   }
 }
 
 void GxGDEP015OC1::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -388,34 +335,39 @@ void GxGDEP015OC1::_writeData(uint8_t data)
 }
 
 void GxGDEP015OC1::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen)
+{
+  _writeCommandData(pCommandData[0], pCommandData + 1, datalen - 1); // command is first byte
+}
+
+void GxGDEP015OC1::_writeCommandData(uint8_t command, const uint8_t* data, uint16_t n)
 {
   if ((_busy >= 0) && digitalRead(_busy))
   {
-    String str = String("command 0x") + String(pCommandData[0], HEX);
+    String str = String("command 0x") + String(command, HEX);
     _waitWhileBusy(str.c_str(), 100); // needed?
   }
-  IO.startTransaction();
-  IO.writeCommand(*pCommandData++);
-  for (uint8_t i = 0; i < datalen - 1; i++)  // sub the command
-  {
-    IO.writeData(*pCommandData++);
-  }
-  IO.endTransaction();
+  IO.writeCommandData(command, data, n);
+}
 
+void GxGDEP015OC1::_writeCommandData(uint8_t command, uint8_t data)
+{
+  _writeCommandData(command, &data, 1);
 }
 
-void GxGDEP015OC1::_waitWhileBusy(const char* comment, uint16_t busy_time)
+void GxGDEP015OC1::_waitWhileBusy(const char* comment, uint16_t busy_time, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   if (_busy >= 0)
   {
     unsigned long start = micros();
     while (1)
     {
       if (!digitalRead(_busy)) break;
-      delay(1);
+      busyIdle();
       if (micros() - start > 10000000)
       {
         if (_diag_enabled) Serial.println("Busy Timeout!");
+        onBusyTimeout();
         break;
       }
     }
@@ -434,6 +386,7 @@ void GxGDEP015OC1::_waitWhileBusy(const char* comment, uint16_t busy_time)
     (void) start;
   }
   else delay(busy_time);
+  onBusyWaitDone();
 }
 
 void GxGDEP015OC1::_setRamDataEntryMode(uint8_t em)
@@ -441,8 +394,7 @@ void GxGDEP015OC1::_setRamDataEntryMode(uint8_t em)
   const uint16_t xPixelsPar = GxGDEP015OC1_X_PIXELS - 1;
   const uint16_t yPixelsPar = GxGDEP015OC1_Y_PIXELS - 1;
   em = gx_uint16_min(em, 0x03);
-  _writeCommand(0x11);
-  _writeData(em);
+  _writeCommandData(0x11, em);
   switch (em)
   {
     case 0x00: // x decrease, y decrease
@@ -466,39 +418,37 @@ void GxGDEP015OC1::_setRamDataEntryMode(uint8_t em)
 
 void GxGDEP015OC1::_SetRamArea(uint8_t Xstart, uint8_t Xend, uint8_t Ystart, uint8_t Ystart1, uint8_t Yend, uint8_t Yend1)
 {
-  _writeCommand(0x44);
-  _writeData(Xstart);
-  _writeData(Xend);
-  _writeCommand(0x45);
-  _writeData(Ystart);
-  _writeData(Ystart1);
-  _writeData(Yend);
-  _writeData(Yend1);
+  {
+    const uint8_t data[] = {Xstart, Xend};
+    _writeCommandData(0x44, data, sizeof(data));
+  }
+  {
+    const uint8_t data[] = {Ystart, Ystart1, Yend, Yend1};
+    _writeCommandData(0x45, data, sizeof(data));
+  }
 }
 
 void GxGDEP015OC1::_SetRamPointer(uint8_t addrX, uint8_t addrY, uint8_t addrY1)
 {
-  _writeCommand(0x4e);
-  _writeData(addrX);
-  _writeCommand(0x4f);
-  _writeData(addrY);
-  _writeData(addrY1);
+  _writeCommandData(0x4e, addrX);
+  {
+    const uint8_t data[] = {addrY, addrY1};
+    _writeCommandData(0x4f, data, sizeof(data));
+  }
 }
 
 void GxGDEP015OC1::_PowerOn(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc0);
+  _writeCommandData(0x22, 0xc0);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOn", power_on_time);
+  _waitWhileBusy("_PowerOn", power_on_time, wait_power_on);
 }
 
 void GxGDEP015OC1::_PowerOff(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc3);
+  _writeCommandData(0x22, 0xc3);
   _writeCommand(0x20);
-  _waitWhileBusy("_PowerOff", power_off_time);
+  _waitWhileBusy("_PowerOff", power_off_time, wait_power_off);
 }
 
 void GxGDEP015OC1::_InitDisplay(uint8_t em)
@@ -527,19 +477,17 @@ void GxGDEP015OC1::_Init_Part(uint8_t em)
 
 void GxGDEP015OC1::_Update_Full(void)
 {
-  _writeCommand(0x22);
-  _writeData(0xc4);
+  _writeCommandData(0x22, 0xc4);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Full", full_refresh_time);
+  _waitWhileBusy("_Update_Full", full_refresh_time, wait_full_refresh);
   _writeCommand(0xff);
 }
 
 void GxGDEP015OC1::_Update_Part(void)
 {
-  _writeCommand(0x22);
-  _writeData(0x04);
+  _writeCommandData(0x22, 0x04);
   _writeCommand(0x20);
-  _waitWhileBusy("_Update_Part", partial_refresh_time);
+  _waitWhileBusy("_Update_Part", partial_refresh_time, wait_partial_refresh);
   _writeCommand(0xff);
 }
 
@@ -552,16 +500,8 @@ void GxGDEP015OC1::drawPaged(void (*drawCallback)(void))
   for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_buffer, GxGDEP015OC1_PAGE_HEIGHT * (GxGDEP015OC1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -577,16 +517,8 @@ void GxGDEP015OC1::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEP015OC1_PAGE_HEIGHT * (GxGDEP015OC1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -602,16 +534,8 @@ void GxGDEP015OC1::drawPaged(void (*drawCallback)(const void*), const void* p)
   for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEP015OC1_PAGE_HEIGHT * (GxGDEP015OC1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -627,16 +551,8 @@ void GxGDEP015OC1::drawPaged(void (*drawCallback)(const void*, const void*), con
   for (_current_page = 0; _current_page < GxGDEP015OC1_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEP015OC1_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEP015OC1_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEP015OC1_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_buffer, GxGDEP015OC1_PAGE_HEIGHT * (GxGDEP015OC1_WIDTH / 8), true);
   }
   _current_page = -1;
   _Update_Full();
@@ -682,7 +598,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -697,7 +613,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -725,7 +641,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -740,7 +656,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -768,7 +684,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -783,7 +699,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -811,7 +727,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -826,7 +742,7 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEP015OC1_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
@@ -838,19 +754,23 @@ void GxGDEP015OC1::drawPagedToWindow(void (*drawCallback)(const void*, const voi
 
 void GxGDEP015OC1::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _Init_Full(em);
   _writeCommand(0x24);
-  for (uint32_t y = 0; y < GxGDEP015OC1_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEP015OC1_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEP015OC1_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEP015OC1_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEP015OC1_WIDTH / 8 - 4) && (y > GxGDEP015OC1_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEP015OC1_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEP015OC1_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEP015OC1_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEP015OC1_WIDTH / 8 - 4) && (y > GxGDEP015OC1_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEP015OC1_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _Update_Full();
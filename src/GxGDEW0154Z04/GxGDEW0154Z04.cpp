@@ -43,53 +43,7 @@ GxGDEW0154Z04::GxGDEW0154Z04(GxIO& io, int8_t rst, int8_t busy)
   _current_page(-1), _diag_enabled(false),
   _rst(rst), _busy(busy) 
 {
-}
-
-void GxGDEW0154Z04::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW0154Z04_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW0154Z04_WIDTH - x - 1;
-      y = GxGDEW0154Z04_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW0154Z04_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW0154Z04_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    if (i < GxGDEW0154Z04_PAGE_SIZE * _current_page) return;
-    if (i >= GxGDEW0154Z04_PAGE_SIZE * (_current_page + 1)) return;
-    i -= GxGDEW0154Z04_PAGE_SIZE * _current_page;
-  }
-
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+  setBufferLayout(buffer_3c, _black_buffer, _red_buffer, sizeof(_black_buffer), GxGDEW0154Z04_WIDTH / 8, GxGDEW0154Z04_PAGE_HEIGHT, &_current_page);
 }
 
 
@@ -100,8 +54,9 @@ void GxGDEW0154Z04::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -126,26 +81,30 @@ void GxGDEW0154Z04::fillScreen(uint16_t color)
     _black_buffer[x] = black;
     _red_buffer[x] = red;
   }
+  bufferFilled(color);
 }
 
 void GxGDEW0154Z04::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+  IO.startTransaction();
   {
-    uint8_t data = (i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF;
-    _writeData(bw2grey[(data & 0xF0) >> 4]);
-    _writeData(bw2grey[data & 0x0F]);
+    GxIO_Burst burst(IO, true);
+    for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+    {
+      uint8_t data = (i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF;
+      burst.write(bw2grey[(data & 0xF0) >> 4]);
+      burst.write(bw2grey[data & 0x0F]);
+    }
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_red_buffer)) ? ~_red_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _red_buffer, sizeof(_red_buffer), 0, GxGDEW0154Z04_BUFFER_SIZE, true);
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -157,73 +116,90 @@ void  GxGDEW0154Z04::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, u
 
 void GxGDEW0154Z04::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE * 2; i++)
   {
+    GxIO_Burst burst(IO);
+    for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE * 2; i++)
+    {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    _writeData((i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00);
+      burst.write((i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00);
 #else
-    _writeData((i < black_size) ? black_bitmap[i] : 0x00);
+      burst.write((i < black_size) ? black_bitmap[i] : 0x00);
 #endif
+    }
   }
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
   {
+    GxIO_Burst burst(IO);
+    for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+    {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    _writeData((i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00);
+      burst.write((i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00);
 #else
-    _writeData((i < red_size) ? red_bitmap[i] : 0x00);
+      burst.write((i < red_size) ? red_bitmap[i] : 0x00);
 #endif
+    }
   }
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPicture");
+  _waitWhileBusy("drawPicture", wait_refresh);
   _sleep();
 }
 
 void GxGDEW0154Z04::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+  IO.startTransaction();
   {
-    uint8_t data = 0xFF; // white is 0xFF on device
-    if (i < black_size)
+    GxIO_Burst burst(IO, true);
+    for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
     {
+      uint8_t data = 0xFF; // white is 0xFF on device
+      if (i < black_size)
+      {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&black_bitmap[i]);
+        data = pgm_read_byte(&black_bitmap[i]);
 #else
-      data = black_bitmap[i];
+        data = black_bitmap[i];
 #endif
-      if (mode & bm_invert) data = ~data;
+        if (mode & bm_invert) data = ~data;
+      }
+      burst.write(bw2grey[(data & 0xF0) >> 4]);
+      burst.write(bw2grey[data & 0x0F]);
     }
-    _writeData(bw2grey[(data & 0xF0) >> 4]);
-    _writeData(bw2grey[data & 0x0F]);
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
   {
-    uint8_t data = 0xFF; // white is 0xFF on device
-    if (i < red_size)
+    GxIO_Burst burst(IO);
+    for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
     {
+      uint8_t data = 0xFF; // white is 0xFF on device
+      if (i < red_size)
+      {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      data = pgm_read_byte(&red_bitmap[i]);
+        data = pgm_read_byte(&red_bitmap[i]);
 #else
-      data = red_bitmap[i];
+        data = red_bitmap[i];
 #endif
-      if (mode & bm_invert_red) data = ~data;
+        if (mode & bm_invert_red) data = ~data;
+      }
+      burst.write(data);
     }
-    _writeData(data);
   }
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPicture");
+  _waitWhileBusy("drawPicture", wait_refresh);
   _sleep();
 }
 
 void GxGDEW0154Z04::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_default) mode |= bm_normal; // no change
   uint8_t mask = 0xFF; // black
@@ -231,43 +207,40 @@ void GxGDEW0154Z04::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mod
   //uint8_t mask = 0b1010101010101010; // (dark) grey, same grey
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+  IO.startTransaction();
   {
+    GxIO_Burst burst(IO, true);
+    for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
+    {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    uint8_t data = (i < size) ? pgm_read_byte(&bitmap[i]) : 0x00;
+      uint8_t data = (i < size) ? pgm_read_byte(&bitmap[i]) : 0x00;
 #else
-    uint8_t data = (i < size) ? bitmap[i] : 0x00;
+      uint8_t data = (i < size) ? bitmap[i] : 0x00;
 #endif
-    if (mode & bm_invert) data = ~data;
-    _writeData(~(bw2grey[(data & 0xF0) >> 4] & mask));
-    _writeData(~(bw2grey[data & 0x0F] & mask));
+      if (mode & bm_invert) data = ~data;
+      burst.write(~(bw2grey[(data & 0xF0) >> 4] & mask));
+      burst.write(~(bw2grey[data & 0x0F] & mask));
+    }
   }
+  IO.endTransaction();
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF);
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0154Z04_BUFFER_SIZE);
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawBitmap");
+  _waitWhileBusy("drawBitmap", wait_refresh);
   _sleep();
 }
 
 void GxGDEW0154Z04::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE * 2; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0154Z04_BUFFER_SIZE * 2); // white is 0xFF on device
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0154Z04_BUFFER_SIZE); // white is 0xFF on device
   _writeCommand(0x12);      //display refresh
-  _waitWhileBusy("eraseDisplay");
+  _waitWhileBusy("eraseDisplay", wait_refresh);
   _sleep();
 }
 
@@ -286,16 +259,18 @@ void GxGDEW0154Z04::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void GxGDEW0154Z04::_waitWhileBusy(const char* comment)
+void GxGDEW0154Z04::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 10000000)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -312,6 +287,7 @@ void GxGDEW0154Z04::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEW0154Z04::_wakeUp()
@@ -322,46 +298,44 @@ void GxGDEW0154Z04::_wakeUp()
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
   }
 
-  _writeCommand(0x01);
-  _writeData(0x07);
-  _writeData(0x00);
-  _writeData(0x08);
-  _writeData(0x00);
-  _writeCommand(0x06);
-  _writeData(0x07);
-  _writeData(0x07);
-  _writeData(0x07);
+  {
+    const uint8_t data[] = {0x07, 0x00, 0x08, 0x00};
+    IO.writeCommandData(0x01, data, sizeof(data));
+  }
+  {
+    const uint8_t data[] = {0x07, 0x07, 0x07};
+    IO.writeCommandData(0x06, data, sizeof(data));
+  }
   _writeCommand(0x04);
-  _waitWhileBusy("Power On");
-  _writeCommand(0X00);
-  _writeData(0xcf);
-  _writeCommand(0X50);
-  _writeData(0x37);
-  _writeCommand(0x30);
-  _writeData(0x39);
-  _writeCommand(0x61);
-  _writeData(0xC8);
-  _writeData(0x00);
-  _writeData(0xC8);
-  _writeCommand(0x82);
-  _writeData(0x0E);
+  _waitWhileBusy("Power On", wait_power_on);
+  IO.writeCommandData(0X00, 0xcf);
+  IO.writeCommandData(0X50, 0x37);
+  IO.writeCommandData(0x30, 0x39);
+  {
+    const uint8_t data[] = {0xC8, 0x00, 0xC8};
+    IO.writeCommandData(0x61, data, sizeof(data));
+  }
+  IO.writeCommandData(0x82, 0x0E);
   _writeLUT();
 }
 
 void GxGDEW0154Z04::_sleep(void)
 {
-  _writeCommand(0X50);
-  _writeData(0x17);    //BD floating
-  _writeCommand(0x82);     //to solve Vcom drop
-  _writeData(0x00);
-  _writeCommand(0x01);     //power setting
-  _writeData(0x02);    //gate switch to external
-  _writeData(0x00);
-  _writeData(0x00);
-  _writeData(0x00);
+  IO.writeCommandData(0X50, 0x17); // BD floating
+  IO.writeCommandData(0x82, 0x00); // to solve Vcom drop
+  {
+    const uint8_t data[] =
+    {
+      0x02, //gate switch to external
+      0x00,
+      0x00,
+      0x00
+    };
+    IO.writeCommandData(0x01, data, sizeof(data)); //power setting
+  }
   delay(1500);     //delay 1.5S
   _writeCommand(0X02);     //power off
 }
@@ -372,108 +346,43 @@ void GxGDEW0154Z04::_writeLUT(void)
 {
   unsigned int count;
   // lut_bw
-  _writeCommand(0x20);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_vcom0[count]));
-  }
+  IO.writeCommandDataPGM(0x20, lut_vcom0, 15);
 
-  _writeCommand(0x21);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_w[count]));
-  }
+  IO.writeCommandDataPGM(0x21, lut_w, 15);
 
-  _writeCommand(0x22);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_b[count]));
-  }
+  IO.writeCommandDataPGM(0x22, lut_b, 15);
 
-  _writeCommand(0x23);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_g1[count]));
-  }
+  IO.writeCommandDataPGM(0x23, lut_g1, 15);
 
-  _writeCommand(0x24);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_g2[count]));
-  }
+  IO.writeCommandDataPGM(0x24, lut_g2, 15);
   // lut_red
-  _writeCommand(0x25);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_vcom1[count]));
-  }
+  IO.writeCommandDataPGM(0x25, lut_vcom1, 15);
 
-  _writeCommand(0x26);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_red0[count]));
-  }
+  IO.writeCommandDataPGM(0x26, lut_red0, 15);
 
-  _writeCommand(0x27);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(pgm_read_byte(&lut_red1[count]));
-  }
+  IO.writeCommandDataPGM(0x27, lut_red1, 15);
 }
 
 #else
 
 void GxGDEW0154Z04::_writeLUT(void)
 {
-  unsigned int count;
   // lut_bw
-  _writeCommand(0x20);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_vcom0[count]);
-  }
+  IO.writeCommandData(0x20, lut_vcom0, 15);
 
-  _writeCommand(0x21);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_w[count]);
-  }
+  IO.writeCommandData(0x21, lut_w, 15);
 
-  _writeCommand(0x22);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_b[count]);
-  }
+  IO.writeCommandData(0x22, lut_b, 15);
 
-  _writeCommand(0x23);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_g1[count]);
-  }
+  IO.writeCommandData(0x23, lut_g1, 15);
 
-  _writeCommand(0x24);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_g2[count]);
-  }
+  IO.writeCommandData(0x24, lut_g2, 15);
   // lut_red
-  _writeCommand(0x25);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_vcom1[count]);
-  }
+  IO.writeCommandData(0x25, lut_vcom1, 15);
 
-  _writeCommand(0x26);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_red0[count]);
-  }
+  IO.writeCommandData(0x26, lut_red0, 15);
 
-  _writeCommand(0x27);
-  for (count = 0; count < 15; count++)
-  {
-    _writeData(lut_red1[count]);
-  }
+  IO.writeCommandData(0x27, lut_red1, 15);
 }
 
 #endif
@@ -486,36 +395,33 @@ void GxGDEW0154Z04::drawPaged(void (*drawCallback)(void))
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
+          burst.write(~bw2grey[(data & 0xF0) >> 4]);
+          burst.write(~bw2grey[data & 0x0F]);
+        }
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW0154Z04_PAGE_HEIGHT * (GxGDEW0154Z04_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -527,36 +433,33 @@ void GxGDEW0154Z04::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
+          burst.write(~bw2grey[(data & 0xF0) >> 4]);
+          burst.write(~bw2grey[data & 0x0F]);
+        }
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW0154Z04_PAGE_HEIGHT * (GxGDEW0154Z04_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -568,36 +471,33 @@ void GxGDEW0154Z04::drawPaged(void (*drawCallback)(const void*), const void* p)
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
+          burst.write(~bw2grey[(data & 0xF0) >> 4]);
+          burst.write(~bw2grey[data & 0x0F]);
+        }
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW0154Z04_PAGE_HEIGHT * (GxGDEW0154Z04_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -609,63 +509,61 @@ void GxGDEW0154Z04::drawPaged(void (*drawCallback)(const void*, const void*), co
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p1, p2);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(~bw2grey[(data & 0xF0) >> 4]);
-        _writeData(~bw2grey[data & 0x0F]);
+        for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
+          burst.write(~bw2grey[(data & 0xF0) >> 4]);
+          burst.write(~bw2grey[data & 0x0F]);
+        }
       }
     }
+    IO.endTransaction();
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0154Z04_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0154Z04_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0154Z04_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0154Z04_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(~data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW0154Z04_PAGE_HEIGHT * (GxGDEW0154Z04_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
 void GxGDEW0154Z04::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t y = 0; y < GxGDEW0154Z04_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEW0154Z04_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEW0154Z04_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW0154Z04_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW0154Z04_WIDTH / 8 - 4) && (y > GxGDEW0154Z04_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW0154Z04_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEW0154Z04_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW0154Z04_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW0154Z04_WIDTH / 8 - 4) && (y > GxGDEW0154Z04_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW0154Z04_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+        burst.write(data);
+      }
     }
   }
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0154Z04_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF);
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0154Z04_BUFFER_SIZE);
   _writeCommand(0x12);      //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
@@ -37,10 +37,10 @@ class GxGDEW0154Z04 : public GxEPD
 #else
     GxGDEW0154Z04(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
+    bool hasUpdateWindow() {return false;}; // no partial update
     // to buffer, may be cropped, drawPixel() used, update needed
     void  drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode = bm_normal);
     // to full screen, filled with white if size is less, no update needed, 4 gray levels + red, for example
@@ -71,7 +71,7 @@ class GxGDEW0154Z04 : public GxEPD
     void _writeLUT();
     void _wakeUp();
     void _sleep();
-    void _waitWhileBusy(const char* comment = 0);
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
   private:
 #if defined(__AVR)
     uint8_t _black_buffer[GxGDEW0154Z04_PAGE_SIZE];
@@ -37,7 +37,6 @@ class GxGDEW0213T5D : public GxEPD
 #else
     GxGDEW0213T5D(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
@@ -79,7 +78,7 @@ class GxGDEW0213T5D : public GxEPD
     void _sleep();
     void _Init_FullUpdate();
     void _Init_PartialUpdate();
-    void _waitWhileBusy(const char* comment = 0);
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
 #if defined(__AVR)
@@ -93,6 +92,7 @@ class GxGDEW0213T5D : public GxEPD
     bool _diag_enabled;
     int8_t _rst;
     int8_t _busy;
+    register_set _registers_loaded; // by _Init_FullUpdate() or _Init_PartialUpdate()
     static const unsigned char lut_20_vcomDC_partial[];
     static const unsigned char lut_21_ww_partial[];
     static const unsigned char lut_22_bw_partial[];
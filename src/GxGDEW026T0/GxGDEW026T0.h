@@ -37,7 +37,6 @@ class GxGDEW026T0 : public GxEPD
 #else
     GxGDEW026T0(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
@@ -75,12 +74,12 @@ class GxGDEW026T0 : public GxEPD
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _writeData(uint8_t data);
     void _writeCommand(uint8_t command);
-    void _writeDataPGM(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes = 0);
+    void _writeCommandDataPGM(uint8_t command, const uint8_t* data, uint16_t n, int16_t fill_with_zeroes = 0);
     void _wakeUp();
     void _sleep();
     void _Init_FullUpdate();
     void _Init_PartialUpdate();
-    void _waitWhileBusy(const char* comment = 0);
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
 #if defined(__AVR)
@@ -94,6 +93,7 @@ class GxGDEW026T0 : public GxEPD
     bool _diag_enabled;
     int8_t _rst;
     int8_t _busy;
+    register_set _registers_loaded; // by _Init_FullUpdate() or _Init_PartialUpdate()
     static const unsigned char lut_20_vcomDC[];
     static const unsigned char lut_21_ww[];
     static const unsigned char lut_22_bw[];
@@ -78,53 +78,7 @@ GxGDEW027C44::GxGDEW027C44(GxIO& io, int8_t rst, int8_t busy)
     _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEW027C44::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW027C44_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW027C44_WIDTH - x - 1;
-      y = GxGDEW027C44_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW027C44_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW027C44_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW027C44_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW027C44_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW027C44_WIDTH / 8;
-  }
-
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+  setBufferLayout(buffer_3c, _black_buffer, _red_buffer, sizeof(_black_buffer), GxGDEW027C44_WIDTH / 8, GxGDEW027C44_PAGE_HEIGHT, &_current_page);
 }
 
 
@@ -135,8 +89,9 @@ void GxGDEW027C44::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -162,25 +117,21 @@ void GxGDEW027C44::fillScreen(uint16_t color)
     _black_buffer[x] = black;
     _red_buffer[x] = red;
   }
+  bufferFilled(color);
 }
 
 void GxGDEW027C44::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_black_buffer)) ? _black_buffer[i] : 0x00);
-  }
+  writeBufferData(IO, _black_buffer, sizeof(_black_buffer), 0, GxGDEW027C44_BUFFER_SIZE, false);
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_red_buffer)) ? _red_buffer[i] : 0x00);
-  }
+  writeBufferData(IO, _red_buffer, sizeof(_red_buffer), 0, GxGDEW027C44_BUFFER_SIZE, false);
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -192,91 +143,106 @@ void  GxGDEW027C44::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEW027C44::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size)
 {
+  invalidateShadow();
   drawPicture(black_bitmap, red_bitmap, black_size, red_size, bm_normal);
 }
 
 void GxGDEW027C44::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_partial_update)
   {
     _using_partial_mode = true;
     _wakeUp();
     _setPartialRamArea(0x14, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < black_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < black_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
+          data = pgm_read_byte(&black_bitmap[i]);
 #else
-        data = black_bitmap[i];
+          data = black_bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _setPartialRamArea(0x15, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < red_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < red_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
+          data = pgm_read_byte(&red_bitmap[i]);
 #else
-        data = red_bitmap[i];
+          data = red_bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _refreshWindow(0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    _waitWhileBusy("drawPicture");
+    _waitWhileBusy("drawPicture", wait_refresh);
   }
   else
   {
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < black_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < black_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
+          data = pgm_read_byte(&black_bitmap[i]);
 #else
-        data = black_bitmap[i];
+          data = black_bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < red_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < red_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
+          data = pgm_read_byte(&red_bitmap[i]);
 #else
-        data = red_bitmap[i];
+          data = red_bitmap[i];
 #endif
-        if (mode & bm_invert_red) data = ~data;
+          if (mode & bm_invert_red) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawPicture");
+    _waitWhileBusy("drawPicture", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW027C44::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_default) mode |= bm_normal; // no change
   if (mode & bm_partial_update)
@@ -284,100 +250,90 @@ void GxGDEW027C44::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = true;
     _wakeUp();
     _setPartialRamArea(0x14, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _setPartialRamArea(0x15, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0);
-    }
+    GxIO_Burst(IO).fill(0, GxGDEW027C44_BUFFER_SIZE);
     _refreshWindow(0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
   }
   else
   {
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0);
-    }
+    GxIO_Burst(IO).fill(0, GxGDEW027C44_BUFFER_SIZE);
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW027C44::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
     if (!_using_partial_mode) _wakeUp();
     _using_partial_mode = true; // remember
     _setPartialRamArea(0x14, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    GxIO_Burst(IO).fill(0x00, GxGDEW027C44_BUFFER_SIZE);
     _setPartialRamArea(0x15, 0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    GxIO_Burst(IO).fill(0x00, GxGDEW027C44_BUFFER_SIZE);
     _refreshWindow(0, 0, GxGDEW027C44_WIDTH, GxGDEW027C44_HEIGHT);
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
   }
   else
   {
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    GxIO_Burst(IO).fill(0x00, GxGDEW027C44_BUFFER_SIZE);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-    {
-      _writeData(0x00);
-    }
+    GxIO_Burst(IO).fill(0x00, GxGDEW027C44_BUFFER_SIZE);
     _writeCommand(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW027C44::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation)
   {
@@ -404,11 +360,12 @@ void GxGDEW027C44::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   _using_partial_mode = true;
   _writeToWindow(x, y, x, y, w, h);
   _refreshWindow(x, y, w, h);
-  _waitWhileBusy("updateWindow");
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
 }
 
 void GxGDEW027C44::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -439,7 +396,7 @@ void GxGDEW027C44::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h);
   _refreshWindow(xd, yd, w, h);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   delay(500); // don't stress this display
 }
 
@@ -457,23 +414,13 @@ void GxGDEW027C44::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   int16_t xe = (xs / 8) + (w / 8);
   for (int16_t y1 = ys; y1 < ys + h; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 < xe; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-      IO.writeDataTransaction(data);
-    }
+    writeBufferData(IO, _black_buffer, sizeof(_black_buffer), y1 * (GxGDEW027C44_WIDTH / 8) + xs / 8, xe - xs / 8, false);
   }
   delay(2);
   _setPartialRamArea(0x15, xd, yd, w, h);
   for (int16_t y1 = ys; y1 < ys + h; y1++)
   {
-    for (int16_t x1 = xs / 8; x1 < xe; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-      IO.writeDataTransaction(data);
-    }
+    writeBufferData(IO, _red_buffer, sizeof(_red_buffer), y1 * (GxGDEW027C44_WIDTH / 8) + xs / 8, xe - xs / 8, false);
   }
   delay(2);
 }
@@ -486,30 +433,20 @@ void GxGDEW027C44::powerDown()
 
 void GxGDEW027C44::_setPartialRamArea(uint8_t command, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  IO.writeCommandTransaction(command);
-  IO.writeDataTransaction(x >> 8);
-  IO.writeDataTransaction(x & 0xf8);
-  IO.writeDataTransaction(y >> 8);
-  IO.writeDataTransaction(y & 0xff);
-  IO.writeDataTransaction(w >> 8);
-  IO.writeDataTransaction(w & 0xf8);
-  IO.writeDataTransaction(h >> 8);
-  IO.writeDataTransaction(h & 0xff);
+  {
+    const uint8_t data[] = {uint8_t(x >> 8), uint8_t(x & 0xf8), uint8_t(y >> 8), uint8_t(y & 0xff), uint8_t(w >> 8), uint8_t(w & 0xf8), uint8_t(h >> 8), uint8_t(h & 0xff)};
+    IO.writeCommandData(command, data, sizeof(data));
+  }
 }
 
 void GxGDEW027C44::_refreshWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   w += (x % 8) + 7;
   h = gx_uint16_min(h, 256); // strange controller error
-  IO.writeCommandTransaction(0x16);
-  IO.writeDataTransaction(x >> 8);
-  IO.writeDataTransaction(x & 0xf8);
-  IO.writeDataTransaction(y >> 8);
-  IO.writeDataTransaction(y & 0xff);
-  IO.writeDataTransaction(w >> 8);
-  IO.writeDataTransaction(w & 0xf8);
-  IO.writeDataTransaction(h >> 8);
-  IO.writeDataTransaction(h & 0xff);
+  {
+    const uint8_t data[] = {uint8_t(x >> 8), uint8_t(x & 0xf8), uint8_t(y >> 8), uint8_t(y & 0xff), uint8_t(w >> 8), uint8_t(w & 0xf8), uint8_t(h >> 8), uint8_t(h & 0xff)};
+    IO.writeCommandData(0x16, data, sizeof(data));
+  }
 }
 
 void GxGDEW027C44::_writeCommand(uint8_t command)
@@ -522,16 +459,18 @@ void GxGDEW027C44::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void GxGDEW027C44::_waitWhileBusy(const char* comment)
+void GxGDEW027C44::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 20000000) // > 15.5s !
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -548,6 +487,7 @@ void GxGDEW027C44::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEW027C44::_wakeUp()
@@ -558,111 +498,92 @@ void GxGDEW027C44::_wakeUp()
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
   }
 
-  _writeCommand(0x01);
-  _writeData (0x03);
-  _writeData (0x00);
-  _writeData (0x2b);
-  _writeData (0x2b);
-  _writeData (0x09);
+  {
+    const uint8_t data[] = {0x03, 0x00, 0x2b, 0x2b, 0x09};
+    IO.writeCommandData(0x01, data, sizeof(data));
+  }
 
-  _writeCommand(0x06);
-  _writeData (0x07);
-  _writeData (0x07);
-  _writeData (0x17);
+  {
+    const uint8_t data[] = {0x07, 0x07, 0x17};
+    IO.writeCommandData(0x06, data, sizeof(data));
+  }
 
-  _writeCommand(0xF8);
-  _writeData (0x60);
-  _writeData (0xA5);
+  {
+    const uint8_t data[] = {0x60, 0xA5};
+    IO.writeCommandData(0xF8, data, sizeof(data));
+  }
 
-  _writeCommand(0xF8);
-  _writeData (0x89);
-  _writeData (0xA5);
+  {
+    const uint8_t data[] = {0x89, 0xA5};
+    IO.writeCommandData(0xF8, data, sizeof(data));
+  }
 
-  _writeCommand(0xF8);
-  _writeData (0x90);
-  _writeData (0x00);
+  {
+    const uint8_t data[] = {0x90, 0x00};
+    IO.writeCommandData(0xF8, data, sizeof(data));
+  }
 
-  _writeCommand(0xF8);
-  _writeData (0x93);
-  _writeData (0x2A);
+  {
+    const uint8_t data[] = {0x93, 0x2A};
+    IO.writeCommandData(0xF8, data, sizeof(data));
+  }
 
-  _writeCommand(0xF8);
-  _writeData (0x73);
-  _writeData (0x41);
+  {
+    const uint8_t data[] = {0x73, 0x41};
+    IO.writeCommandData(0xF8, data, sizeof(data));
+  }
 
-  _writeCommand(0x16);
-  _writeData(0x00);
+  IO.writeCommandData(0x16, 0x00);
 
   _writeCommand(0x04);
-  _waitWhileBusy("_wakeUp Power On");
+  _waitWhileBusy("_wakeUp Power On", wait_power_on);
 
-  _writeCommand(0x00);
-  _writeData(0xaf); // by register LUT
+  IO.writeCommandData(0x00, 0xaf); // by register LUT
 
-  _writeCommand(0x30);      //PLL�趨 // define by OTP
-  _writeData (0x3a);       //3A 100HZ   29 150Hz 39 200HZ 31 171HZ
+  IO.writeCommandData(0x30, 0x3a); // PLL�趨 // define by OTP : 3A 100HZ   29 150Hz 39 200HZ 31 171HZ
 
-  _writeCommand(0x61);      //�����趨 // define by OTP
-  _writeData (0x00);
-  _writeData (0xb0);       //176
-  _writeData (0x01);
-  _writeData (0x08);    //264
+  {
+    const uint8_t data[] =
+    {
+      0x00,
+      0xb0, //176
+      0x01,
+      0x08 //264
+    };
+    IO.writeCommandData(0x61, data, sizeof(data)); //�����趨 // define by OTP
+  }
 
-  _writeCommand(0x82);      //vcom�趨 // define by OTP
-  _writeData (0x12);
+  IO.writeCommandData(0x82, 0x12); // vcom�趨 // define by OTP
 
-  _writeCommand(0X50);      // define by OTP
-  _writeData(0x87);   // define by OTP
+  IO.writeCommandData(0X50, 0x87); // define by OTP : define by OTP
   _writeLUT();              //д��lut
 }
 
 void GxGDEW027C44::_sleep(void)
 {
   _writeCommand(0x02); // power off
-  _waitWhileBusy("_sleep Power Off");
+  _waitWhileBusy("_sleep Power Off", wait_power_off);
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData (0xa5);
+    IO.writeCommandData(0x07, 0xa5); // deep sleep
   }
 }
 
 void GxGDEW027C44::_writeLUT(void)
 {
-  unsigned int count;
   {
-    _writeCommand(0x20);							//vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC[count]);
-    }
+    IO.writeCommandData(0x20, lut_20_vcomDC, 44); //vcom
 
-    _writeCommand(0x21);							//ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21[count]);
-    }
+    IO.writeCommandData(0x21, lut_21, 42); //ww --
 
-    _writeCommand(0x22);							//bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_red[count]);
-    }
+    IO.writeCommandData(0x22, lut_22_red, 42); //bw r
 
-    _writeCommand(0x23);							//wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_white[count]);
-    }
+    IO.writeCommandData(0x23, lut_23_white, 42); //wb w
 
-    _writeCommand(0x24);							//bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_black[count]);
-    }
+    IO.writeCommandData(0x24, lut_24_black, 42); //bb b
   }
 }
 
@@ -675,35 +596,19 @@ void GxGDEW027C44::drawPaged(void (*drawCallback)(void))
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -716,35 +621,19 @@ void GxGDEW027C44::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -757,35 +646,19 @@ void GxGDEW027C44::drawPaged(void (*drawCallback)(const void*), const void* p)
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -798,35 +671,19 @@ void GxGDEW027C44::drawPaged(void (*drawCallback)(const void*, const void*), con
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW027C44_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW027C44_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW027C44_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW027C44_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        _writeData(data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW027C44_PAGE_HEIGHT * (GxGDEW027C44_WIDTH / 8), false);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -868,13 +725,13 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
 }
 
@@ -895,14 +752,14 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       //fillScreen(p);
       uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
 }
 
@@ -923,13 +780,13 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
 }
 
@@ -950,41 +807,42 @@ void GxGDEW027C44::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEW027C44_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   _refreshWindow(x, y, w, h);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
 }
 
 void GxGDEW027C44::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t y = 0; y < GxGDEW027C44_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEW027C44_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEW027C44_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW027C44_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW027C44_WIDTH / 8 - 4) && (y > GxGDEW027C44_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW027C44_HEIGHT - 33)) data = 0x00;
-      _writeData(~data);
+      for (uint32_t x = 0; x < GxGDEW027C44_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW027C44_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW027C44_WIDTH / 8 - 4) && (y > GxGDEW027C44_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW027C44_HEIGHT - 33)) data = 0x00;
+        burst.write(~data);
+      }
     }
   }
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW027C44_BUFFER_SIZE; i++)
-  {
-    _writeData(0);
-  }
+  GxIO_Burst(IO).fill(0, GxGDEW027C44_BUFFER_SIZE);
   _writeCommand(0x12);      //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
 
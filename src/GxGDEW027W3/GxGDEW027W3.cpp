@@ -138,46 +138,9 @@ const uint8_t GxGDEW027W3::lut_24_bb_partial[] =
 GxGDEW027W3::GxGDEW027W3(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT), IO(io),
     _current_page(-1), _initial(true), _using_partial_mode(false), _diag_enabled(false),
-    _rst(rst), _busy(busy)
+    _rst(rst), _busy(busy), _registers_loaded(registers_unknown)
 {
-}
-
-void GxGDEW027W3::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW027W3_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW027W3_WIDTH - x - 1;
-      y = GxGDEW027W3_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW027W3_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW027W3_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW027W3_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW027W3_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW027W3_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEW027W3_WIDTH / 8, GxGDEW027W3_PAGE_HEIGHT, &_current_page);
 }
 
 
@@ -188,8 +151,9 @@ void GxGDEW027W3::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -209,34 +173,27 @@ void GxGDEW027W3::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEW027W3::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   if (_initial)
   { // init old data
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE); // 0xFF is white
     _initial = false;
   }
   _writeCommand(0x13); // update current data
-  for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_buffer)) ? ~_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEW027W3_BUFFER_SIZE, true);
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _writeCommand(0x10); // update old data
-  for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_buffer)) ? ~_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEW027W3_BUFFER_SIZE, true);
   _sleep();
 }
 
@@ -248,6 +205,7 @@ void  GxGDEW027W3::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 
 void GxGDEW027W3::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_default) mode |= bm_normal; // no change
   if (mode & bm_partial_update)
@@ -258,32 +216,32 @@ void GxGDEW027W3::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
       _using_partial_mode = true; // remember
       // init old data and keep full update wavetable
       _setPartialRamArea(0x14, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-      for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-      {
-        _writeData(0xFF); // 0xFF is white
-      }
+      GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE); // 0xFF is white
     }
     else _Init_PartialUpdate(); // use partial update wavetable
     for (uint8_t command = 0x15; true; command = 0x14)
     { // leave both controller buffers equal
       _setPartialRamArea(command, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-      for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       if (command == 0x14) break;
       _refreshWindow(0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-      _waitWhileBusy("drawBitmap");
+      _waitWhileBusy("drawBitmap", wait_refresh);
     }
   }
   else
@@ -293,31 +251,31 @@ void GxGDEW027W3::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
     if (_initial)
     { // init old data
       _writeCommand(0x10);
-      for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-      {
-        _writeData(0xFF);
-      }
+      GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE);
     }
     for (uint8_t command = 0x13; true; command = 0x10)
     { // leave both controller buffers equal
       _writeCommand(command);
-      for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       if (command == 0x10) break;
       _writeCommand(0x12); //display refresh
-      _waitWhileBusy("drawBitmap");
+      _waitWhileBusy("drawBitmap", wait_refresh);
     }
     _sleep();
   }
@@ -325,6 +283,7 @@ void GxGDEW027W3::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 
 void GxGDEW027W3::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -334,48 +293,34 @@ void GxGDEW027W3::eraseDisplay(bool using_partial_update)
       _using_partial_mode = true; // remember
       // init old data and keep full update wavetable
       _setPartialRamArea(0x14, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-      for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-      {
-        _writeData(0xFF); // 0xFF is white
-      }
+      GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE); // 0xFF is white
     }
     else _Init_PartialUpdate(); // use partial update wavetable
     _setPartialRamArea(0x15, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE); // 0xFF is white
     _refreshWindow(0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     // leave both controller buffers equal
     _setPartialRamArea(0x14, 0, 0, GxGDEW027W3_WIDTH, GxGDEW027W3_HEIGHT);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE); // 0xFF is white
   }
   else
   {
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE); // 0xFF is white
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW027W3_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW027W3_BUFFER_SIZE); // 0xFF is white
     _writeCommand(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW027W3::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (!_using_partial_mode) _wakeUp();
@@ -383,15 +328,16 @@ void GxGDEW027W3::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   _Init_PartialUpdate();
   _writeToWindow(0x15, x, y, x, y, w, h);
   _refreshWindow(x, y, w, h);
-  _waitWhileBusy("updateWindow");
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
   // leave both controller buffers equal
   _writeToWindow(0x14, x, y, x, y, w, h);
   //_refreshWindow(x, y, w, h);
-  //_waitWhileBusy("updateWindow");
+  //_waitWhileBusy("updateWindow", wait_partial_refresh);
 }
 
 void GxGDEW027W3::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -423,11 +369,11 @@ void GxGDEW027W3::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   _Init_PartialUpdate();
   _writeToWindow(0x15, xs, ys, xd, yd, w, h);
   _refreshWindow(xd, yd, w, h);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   // leave both controller buffers equal
   _writeToWindow(0x14, xs, ys, xd, yd, w, h);
   //_refreshWindow(xd, yd, w, h);
-  //_waitWhileBusy("updateToWindow");
+  //_waitWhileBusy("updateToWindow", wait_partial_refresh);
   delay(500); // don't stress this display
 }
 
@@ -446,12 +392,7 @@ void GxGDEW027W3::_writeToWindow(uint8_t command, uint16_t xs, uint16_t ys, uint
   _setPartialRamArea(command, xd, yd, w, h);
   for (uint16_t y1 = ys; y1 < ys + h; y1++)
   {
-    for (uint16_t x1 = xs / 8; x1 < xe; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEW027W3_WIDTH / 8) + xs / 8, xe - xs / 8, true);
   }
   delay(2);
 }
@@ -464,30 +405,20 @@ void GxGDEW027W3::powerDown()
 
 void GxGDEW027W3::_setPartialRamArea(uint8_t command, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  IO.writeCommandTransaction(command);
-  IO.writeDataTransaction(x >> 8);
-  IO.writeDataTransaction(x & 0xf8);
-  IO.writeDataTransaction(y >> 8);
-  IO.writeDataTransaction(y & 0xff);
-  IO.writeDataTransaction(w >> 8);
-  IO.writeDataTransaction(w & 0xf8);
-  IO.writeDataTransaction(h >> 8);
-  IO.writeDataTransaction(h & 0xff);
+  {
+    const uint8_t data[] = {uint8_t(x >> 8), uint8_t(x & 0xf8), uint8_t(y >> 8), uint8_t(y & 0xff), uint8_t(w >> 8), uint8_t(w & 0xf8), uint8_t(h >> 8), uint8_t(h & 0xff)};
+    IO.writeCommandData(command, data, sizeof(data));
+  }
 }
 
 void GxGDEW027W3::_refreshWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   w += (x % 8) + 7;
   h = gx_uint16_min(h, 256); // strange controller error
-  IO.writeCommandTransaction(0x16);
-  IO.writeDataTransaction(x >> 8);
-  IO.writeDataTransaction(x & 0xf8);
-  IO.writeDataTransaction(y >> 8);
-  IO.writeDataTransaction(y & 0xff);
-  IO.writeDataTransaction(w >> 8);
-  IO.writeDataTransaction(w & 0xf8);
-  IO.writeDataTransaction(h >> 8);
-  IO.writeDataTransaction(h & 0xff);
+  {
+    const uint8_t data[] = {uint8_t(x >> 8), uint8_t(x & 0xf8), uint8_t(y >> 8), uint8_t(y & 0xff), uint8_t(w >> 8), uint8_t(w & 0xf8), uint8_t(h >> 8), uint8_t(h & 0xff)};
+    IO.writeCommandData(0x16, data, sizeof(data));
+  }
 }
 
 void GxGDEW027W3::_writeCommand(uint8_t command)
@@ -500,16 +431,18 @@ void GxGDEW027W3::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void GxGDEW027W3::_waitWhileBusy(const char* comment)
+void GxGDEW027W3::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 20000000) // > 15.5s !
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -526,180 +459,122 @@ void GxGDEW027W3::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEW027W3::_wakeUp()
 {
+  _registers_loaded = registers_unknown; // reset or reinitialized below
   // reset required for wakeup
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
   }
 
-  _writeCommand(0x01); //POWER SETTING
-  _writeData (0x03);
-  _writeData (0x00);
-  _writeData (0x2b);
-  _writeData (0x2b);
+  {
+    const uint8_t data[] = {0x03, 0x00, 0x2b, 0x2b};
+    IO.writeCommandData(0x01, data, sizeof(data)); //POWER SETTING
+  }
 
-  _writeCommand(0x06); //boost
-  _writeData (0x07);   //A
-  _writeData (0x07);   //B
-  _writeData (0x17);   //C
+  {
+    const uint8_t data[] =
+    {
+      0x07, //A
+      0x07, //B
+      0x17 //C
+    };
+    IO.writeCommandData(0x06, data, sizeof(data)); //boost
+  }
 
-  _writeCommand(0x16);
-  _writeData(0x00);
+  IO.writeCommandData(0x16, 0x00);
 
   _writeCommand(0x04);
-  _waitWhileBusy("_wakeUp Power On");
+  _waitWhileBusy("_wakeUp Power On", wait_power_on);
 
-  _writeCommand(0x00); //panel setting
-  _writeData(0xbf);    //KW-BF   KWR-AF  BWROTP 0f
+  IO.writeCommandData(0x00, 0xbf); // panel setting : KW-BF   KWR-AF  BWROTP 0f
 
-  _writeCommand(0x30); //PLL setting
-  _writeData (0x3a);   //90 50HZ  3A 100HZ   29 150Hz 39 200HZ 31 171HZ
+  IO.writeCommandData(0x30, 0x3a); // PLL setting : 90 50HZ  3A 100HZ   29 150Hz 39 200HZ 31 171HZ
 
-  _writeCommand(0x61); //resolution setting
-  _writeData (0x00);
-  _writeData (0xb0); //176
-  _writeData (0x01);
-  _writeData (0x08); //264
+  {
+    const uint8_t data[] =
+    {
+      0x00,
+      0xb0, //176
+      0x01,
+      0x08 //264
+    };
+    IO.writeCommandData(0x61, data, sizeof(data)); //resolution setting
+  }
 
-  _writeCommand(0x82); //vcom_DC setting
-  _writeData (0x08);   //0x28:-2.0V,0x12:-0.9V
+  IO.writeCommandData(0x82, 0x08); // vcom_DC setting : 0x28:-2.0V,0x12:-0.9V
   delay(2);
-  _writeCommand(0X50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x97);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  IO.writeCommandData(0X50, 0x97); // VCOM AND DATA INTERVAL SETTING : WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   _Init_FullUpdate();
 }
 
 void GxGDEW027W3::_sleep(void)
 {
   _writeCommand(0x02); // power off
-  _waitWhileBusy("_sleep Power Off");
+  _waitWhileBusy("_sleep Power Off", wait_power_off);
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData (0xa5);
+    IO.writeCommandData(0x07, 0xa5); // deep sleep
   }
 }
 
 void GxGDEW027W3::_Init_FullUpdate(void)
 {
-  _writeCommand(0x82); //vcom_DC setting
-  _writeData (0x08);
-  _writeCommand(0X50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x97);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-  unsigned int count;
+  if (_registers_loaded == registers_full_update) return; // unchanged since loaded
+  IO.writeCommandData(0x82, 0x08); // vcom_DC setting
+  IO.writeCommandData(0X50, 0x97); // VCOM AND DATA INTERVAL SETTING : WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   {
-    _writeCommand(0x20);              //vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC[count]);
-    }
+    IO.writeCommandData(0x20, lut_20_vcomDC, 44); //vcom
 
-    _writeCommand(0x21);              //ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21_ww[count]);
-    }
+    IO.writeCommandData(0x21, lut_21_ww, 42); //ww --
 
-    _writeCommand(0x22);              //bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_bw[count]);
-    }
+    IO.writeCommandData(0x22, lut_22_bw, 42); //bw r
 
-    _writeCommand(0x23);              //wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_wb[count]);
-    }
+    IO.writeCommandData(0x23, lut_23_wb, 42); //wb w
 
-    _writeCommand(0x24);              //bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_bb[count]);
-    }
+    IO.writeCommandData(0x24, lut_24_bb, 42); //bb b
   }
+  _registers_loaded = registers_full_update;
 }
 
 void GxGDEW027W3::_Init_PartialUpdate(void)
 {
-  _writeCommand(0x82); //vcom_DC setting
-  _writeData (0x08);
-  _writeCommand(0X50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x17);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-  unsigned int count;
+  if (_registers_loaded == registers_partial_update) return; // unchanged since loaded
+  IO.writeCommandData(0x82, 0x08); // vcom_DC setting
+  IO.writeCommandData(0X50, 0x17); // VCOM AND DATA INTERVAL SETTING : WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   {
-    _writeCommand(0x20);              //vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC_partial[count]);
-    }
+    IO.writeCommandData(0x20, lut_20_vcomDC_partial, 44); //vcom
 
-    _writeCommand(0x21);              //ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21_ww_partial[count]);
-    }
+    IO.writeCommandData(0x21, lut_21_ww_partial, 42); //ww --
 
-    _writeCommand(0x22);              //bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_bw_partial[count]);
-    }
+    IO.writeCommandData(0x22, lut_22_bw_partial, 42); //bw r
 
-    _writeCommand(0x23);              //wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_wb_partial[count]);
-    }
+    IO.writeCommandData(0x23, lut_23_wb_partial, 42); //wb w
 
-    _writeCommand(0x24);              //bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_bb_partial[count]);
-    }
+    IO.writeCommandData(0x24, lut_24_bb_partial, 42); //bb b
   }
+  _registers_loaded = registers_partial_update;
 }
 
 void GxGDEW027W3::_writeLUT(void)
 {
-  unsigned int count;
   {
-    _writeCommand(0x20);							//vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC[count]);
-    }
+    IO.writeCommandData(0x20, lut_20_vcomDC, 44); //vcom
 
-    _writeCommand(0x21);							//ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21_ww[count]);
-    }
+    IO.writeCommandData(0x21, lut_21_ww, 42); //ww --
 
-    _writeCommand(0x22);							//bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_bw[count]);
-    }
+    IO.writeCommandData(0x22, lut_22_bw, 42); //bw r
 
-    _writeCommand(0x23);							//wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_wb[count]);
-    }
+    IO.writeCommandData(0x23, lut_23_wb, 42); //wb w
 
-    _writeCommand(0x24);							//bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_bb[count]);
-    }
+    IO.writeCommandData(0x24, lut_24_bb, 42); //bb b
   }
 }
 
@@ -714,21 +589,13 @@ void GxGDEW027W3::drawPaged(void (*drawCallback)(void))
     for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback);
+      IO.writeDataTransactionAsync(_buffer, GxGDEW027W3_PAGE_HEIGHT * (GxGDEW027W3_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x10) break;
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawPaged");
+    _waitWhileBusy("drawPaged", wait_full_refresh);
   }
   _sleep();
 }
@@ -744,21 +611,13 @@ void GxGDEW027W3::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
     for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxGDEW027W3_PAGE_HEIGHT * (GxGDEW027W3_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x10) break;
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawPaged");
+    _waitWhileBusy("drawPaged", wait_full_refresh);
   }
   _sleep();
 }
@@ -774,21 +633,13 @@ void GxGDEW027W3::drawPaged(void (*drawCallback)(const void*), const void* p)
     for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p);
+      IO.writeDataTransactionAsync(_buffer, GxGDEW027W3_PAGE_HEIGHT * (GxGDEW027W3_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x10) break;
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawPaged");
+    _waitWhileBusy("drawPaged", wait_full_refresh);
   }
   _sleep();
 }
@@ -804,21 +655,13 @@ void GxGDEW027W3::drawPaged(void (*drawCallback)(const void*, const void*), cons
     for (_current_page = 0; _current_page < GxGDEW027W3_PAGES; _current_page++)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      for (int16_t y1 = 0; y1 < GxGDEW027W3_PAGE_HEIGHT; y1++)
-      {
-        for (int16_t x1 = 0; x1 < GxGDEW027W3_WIDTH / 8; x1++)
-        {
-          uint16_t idx = y1 * (GxGDEW027W3_WIDTH / 8) + x1;
-          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-          _writeData(~data);
-        }
-      }
+      drawPage(drawCallback, p1, p2);
+      IO.writeDataTransactionAsync(_buffer, GxGDEW027W3_PAGE_HEIGHT * (GxGDEW027W3_WIDTH / 8), true);
     }
     _current_page = -1;
     if (command == 0x10) break;
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawPaged");
+    _waitWhileBusy("drawPaged", wait_full_refresh);
   }
   _sleep();
 }
@@ -860,7 +703,7 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback();
+        drawPage(drawCallback);
         uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -868,7 +711,7 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
     _current_page = -1;
     if (command == 0x14) break;
     _refreshWindow(x, y, w, h);
-    _waitWhileBusy("updateToWindow");
+    _waitWhileBusy("updateToWindow", wait_partial_refresh);
   }
 }
 
@@ -888,7 +731,7 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -896,7 +739,7 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     _current_page = -1;
     if (command == 0x14) break;
     _refreshWindow(x, y, w, h);
-    _waitWhileBusy("updateToWindow");
+    _waitWhileBusy("updateToWindow", wait_partial_refresh);
   }
 }
 
@@ -916,7 +759,7 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -924,7 +767,7 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     _current_page = -1;
     if (command == 0x14) break;
     _refreshWindow(x, y, w, h);
-    _waitWhileBusy("updateToWindow");
+    _waitWhileBusy("updateToWindow", wait_partial_refresh);
   }
 }
 
@@ -944,7 +787,7 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*, const void
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p1, p2);
+        drawPage(drawCallback, p1, p2);
         uint16_t ys = yds % GxGDEW027W3_PAGE_HEIGHT;
         _writeToWindow(command, x, ys, x, yds, w, yde - yds);
       }
@@ -952,29 +795,33 @@ void GxGDEW027W3::drawPagedToWindow(void (*drawCallback)(const void*, const void
     _current_page = -1;
     if (command == 0x14) break;
     _refreshWindow(x, y, w, h);
-    _waitWhileBusy("updateToWindow");
+    _waitWhileBusy("updateToWindow", wait_partial_refresh);
   }
 }
 
 void GxGDEW027W3::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x13);
-  for (uint32_t y = 0; y < GxGDEW027W3_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEW027W3_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEW027W3_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW027W3_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW027W3_WIDTH / 8 - 4) && (y > GxGDEW027W3_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW027W3_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEW027W3_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW027W3_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW027W3_WIDTH / 8 - 4) && (y > GxGDEW027W3_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW027W3_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _writeCommand(0x12);      //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
@@ -35,7 +35,6 @@ class GxGDEW027W3 : public GxEPD
 #else
     GxGDEW027W3(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
@@ -80,7 +79,7 @@ class GxGDEW027W3 : public GxEPD
     void _sleep();
     void _Init_FullUpdate();
     void _Init_PartialUpdate();
-    void _waitWhileBusy(const char* comment = 0);
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
 #if defined(__AVR)
@@ -94,6 +93,7 @@ class GxGDEW027W3 : public GxEPD
     bool _diag_enabled;
     int8_t _rst;
     int8_t _busy;
+    register_set _registers_loaded; // by _Init_FullUpdate() or _Init_PartialUpdate()
     static const uint8_t lut_20_vcomDC[];
     static const uint8_t lut_21_ww[];
     static const uint8_t lut_22_bw[];
@@ -86,46 +86,9 @@ const unsigned char GxGDEW029T5D::lut_24_bb_partial[] =
 GxGDEW029T5D::GxGDEW029T5D(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW029T5D_WIDTH, GxGDEW029T5D_HEIGHT), IO(io),
     _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
-    _rst(rst), _busy(busy)
+    _rst(rst), _busy(busy), _registers_loaded(registers_unknown)
 {
-}
-
-void GxGDEW029T5D::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW029T5D_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW029T5D_WIDTH - x - 1;
-      y = GxGDEW029T5D_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW029T5D_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW029T5D_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW029T5D_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW029T5D_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW029T5D_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEW029T5D_WIDTH / 8, GxGDEW029T5D_PAGE_HEIGHT, &_current_page);
 }
 
 
@@ -136,8 +99,9 @@ void GxGDEW029T5D::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_UC8151D);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -156,25 +120,21 @@ void GxGDEW029T5D::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEW029T5D::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_buffer)) ? ~_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEW029T5D_BUFFER_SIZE, true);
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -186,6 +146,7 @@ void  GxGDEW029T5D::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEW029T5D::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   //if (mode & bm_default) mode |= bm_invert; // Snoopy is inverted
   // example bitmaps are made for y-decrement, x-increment, for origin on opposite corner
@@ -201,22 +162,25 @@ void GxGDEW029T5D::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
       IO.writeCommandTransaction(0x91); // partial in
       _setPartialRamArea(0, 0, GxGDEW029T5D_WIDTH - 1, GxGDEW029T5D_HEIGHT - 1);
       _writeCommand(0x13);
-      for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       _writeCommand(0x12); //display refresh
-      _waitWhileBusy("drawBitmap");
+      _waitWhileBusy("drawBitmap", wait_refresh);
       IO.writeCommandTransaction(0x92); // partial out
     } // leave both controller buffers equal
     delay(GxGDEW029T5D_PU_DELAY); // don't stress this display
@@ -226,33 +190,34 @@ void GxGDEW029T5D::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW029T5D::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -264,12 +229,9 @@ void GxGDEW029T5D::eraseDisplay(bool using_partial_update)
       IO.writeCommandTransaction(0x91); // partial in
       _setPartialRamArea(0, 0, GxGDEW029T5D_WIDTH - 1, GxGDEW029T5D_HEIGHT - 1);
       _writeCommand(0x13);
-      for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-      {
-        _writeData(0xFF); // white is 0xFF on device
-      }
+      GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // white is 0xFF on device
       _writeCommand(0x12); //display refresh
-      _waitWhileBusy("eraseDisplay");
+      _waitWhileBusy("eraseDisplay", wait_refresh);
       IO.writeCommandTransaction(0x92); // partial out
       if (_using_partial_mode) break;
     } // leave both controller buffers equal
@@ -279,23 +241,18 @@ void GxGDEW029T5D::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE * 2); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW029T5D::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEW029T5D_WIDTH) return;
@@ -315,15 +272,10 @@ void GxGDEW029T5D::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     IO.writeCommandTransaction(0x13);
     for (int16_t y1 = y; y1 <= ye; y1++)
     {
-      for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW029T5D_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-        IO.writeDataTransaction(~data); // white is 0xFF on device
-      }
+      writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEW029T5D_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
     }
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("updateWindow");
+    _waitWhileBusy("updateWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW029T5D_PU_DELAY); // don't stress this display
@@ -331,6 +283,7 @@ void GxGDEW029T5D::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void GxGDEW029T5D::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -377,15 +330,10 @@ void GxGDEW029T5D::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
     IO.writeCommandTransaction(0x13);
     for (int16_t y1 = ys; y1 <= yse; y1++)
     {
-      for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW029T5D_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-        IO.writeDataTransaction(~data); // white is 0xFF on device
-      }
+      writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEW029T5D_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
     }
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("updateToWindow");
+    _waitWhileBusy("updateToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW029T5D_PU_DELAY); // don't stress this display
@@ -401,16 +349,21 @@ uint16_t GxGDEW029T5D::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 {
   x &= 0xFFF8; // byte boundary
   xe = (xe - 1) | 0x0007; // byte boundary - 1
-  IO.writeCommandTransaction(0x90); // partial window
-  //IO.writeDataTransaction(x / 256);
-  IO.writeDataTransaction(x % 256);
-  //IO.writeDataTransaction(xe / 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  IO.writeDataTransaction(0x01); // don't see any difference
+  {
+    const uint8_t data[] =
+    {
+      //uint8_t(x / 256),
+      uint8_t(x % 256),
+      //uint8_t(xe / 256),
+      uint8_t(xe % 256),
+      uint8_t(y / 256),
+      uint8_t(y % 256),
+      uint8_t(ye / 256),
+      uint8_t(ye % 256),
+      0x01 // don't see any difference
+    };
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   //IO.writeDataTransaction(0x00); // don't see any difference
   return (7 + xe - x) / 8; // number of bytes to transfer per line
 }
@@ -425,16 +378,18 @@ void GxGDEW029T5D::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void GxGDEW029T5D::_waitWhileBusy(const char* comment)
+void GxGDEW029T5D::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 10000000)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -451,40 +406,39 @@ void GxGDEW029T5D::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEW029T5D::_wakeUp()
 {
+  _registers_loaded = registers_unknown; // reset or reinitialized below
   // reset required for wakeup
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
   }
 
-  _writeCommand(0x00); // panel setting
-  _writeData(0x1f);    // LUT from OTP, 128x296
-  _writeCommand(0x61); //resolution setting
-  _writeData (GxGDEW029T5D_WIDTH);
-  _writeData (GxGDEW029T5D_HEIGHT >> 8);
-  _writeData (GxGDEW029T5D_HEIGHT & 0xFF);
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x97);    // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  IO.writeCommandData(0x00, 0x1f); // panel setting : LUT from OTP, 128x296
+  {
+    const uint8_t data[] = {GxGDEW029T5D_WIDTH, uint8_t(GxGDEW029T5D_HEIGHT >> 8), uint8_t(GxGDEW029T5D_HEIGHT & 0xFF)};
+    IO.writeCommandData(0x61, data, sizeof(data)); //resolution setting
+  }
+  IO.writeCommandData(0x50, 0x97); // VCOM AND DATA INTERVAL SETTING : WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   _writeCommand(0x04);
-  _waitWhileBusy("_wakeUp Power On");
+  _waitWhileBusy("_wakeUp Power On", wait_power_on);
   _Init_FullUpdate();
 }
 
 void GxGDEW029T5D::_sleep(void)
 {
   _writeCommand(0x02);      //power off
-  _waitWhileBusy("_sleep Power Off");
+  _waitWhileBusy("_sleep Power Off", wait_power_off);
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData (0xa5);
+    IO.writeCommandData(0x07, 0xa5); // deep sleep
   }
 }
 
@@ -494,42 +448,21 @@ void GxGDEW029T5D::_Init_FullUpdate(void)
 
 void GxGDEW029T5D::_Init_PartialUpdate(void)
 {
-  _writeCommand(0x00); //panel setting
-  _writeData(0xbf);    // LUT from registers
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x17);    // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-  unsigned int count;
+  if (_registers_loaded == registers_partial_update) return; // unchanged since loaded
+  IO.writeCommandData(0x00, 0xbf); // panel setting : LUT from registers
+  IO.writeCommandData(0x50, 0x17); // VCOM AND DATA INTERVAL SETTING : WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   {
-    _writeCommand(0x20);              //vcom
-    for (count = 0; count < 44; count++)
-    {
-      _writeData(lut_20_vcomDC_partial[count]);
-    }
+    IO.writeCommandData(0x20, lut_20_vcomDC_partial, 44); //vcom
 
-    _writeCommand(0x21);              //ww --
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_21_ww_partial[count]);
-    }
+    IO.writeCommandData(0x21, lut_21_ww_partial, 42); //ww --
 
-    _writeCommand(0x22);              //bw r
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_22_bw_partial[count]);
-    }
+    IO.writeCommandData(0x22, lut_22_bw_partial, 42); //bw r
 
-    _writeCommand(0x23);              //wb w
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_23_wb_partial[count]);
-    }
+    IO.writeCommandData(0x23, lut_23_wb_partial, 42); //wb w
 
-    _writeCommand(0x24);              //bb b
-    for (count = 0; count < 42; count++)
-    {
-      _writeData(lut_24_bb_partial[count]);
-    }
+    IO.writeCommandData(0x24, lut_24_bb_partial, 42); //bb b
   }
+  _registers_loaded = registers_partial_update;
 }
 
 void GxGDEW029T5D::drawPaged(void (*drawCallback)(void))
@@ -538,28 +471,17 @@ void GxGDEW029T5D::drawPaged(void (*drawCallback)(void))
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW029T5D_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW029T5D_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW029T5D_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW029T5D_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW029T5D_PAGE_HEIGHT * (GxGDEW029T5D_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -569,28 +491,17 @@ void GxGDEW029T5D::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW029T5D_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW029T5D_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW029T5D_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW029T5D_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW029T5D_PAGE_HEIGHT * (GxGDEW029T5D_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -600,28 +511,17 @@ void GxGDEW029T5D::drawPaged(void (*drawCallback)(const void*), const void* p)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW029T5D_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW029T5D_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW029T5D_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW029T5D_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW029T5D_PAGE_HEIGHT * (GxGDEW029T5D_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -631,28 +531,17 @@ void GxGDEW029T5D::drawPaged(void (*drawCallback)(const void*, const void*), con
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW029T5D_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW029T5D_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW029T5D_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW029T5D_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW029T5D_PAGE_HEIGHT * (GxGDEW029T5D_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -702,22 +591,17 @@ void GxGDEW029T5D::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback();
+        drawPage(drawCallback);
         uint16_t ys = yds % GxGDEW029T5D_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW029T5D_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW029T5D_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW029T5D_PU_DELAY); // don't stress this display
@@ -748,22 +632,17 @@ void GxGDEW029T5D::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEW029T5D_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW029T5D_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW029T5D_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW029T5D_PU_DELAY); // don't stress this display
@@ -794,22 +673,17 @@ void GxGDEW029T5D::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEW029T5D_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW029T5D_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW029T5D_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW029T5D_PU_DELAY); // don't stress this display
@@ -840,22 +714,17 @@ void GxGDEW029T5D::drawPagedToWindow(void (*drawCallback)(const void*, const voi
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p1, p2);
+        drawPage(drawCallback, p1, p2);
         uint16_t ys = yds % GxGDEW029T5D_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW029T5D_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW029T5D_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW029T5D_PU_DELAY); // don't stress this display
@@ -863,28 +732,29 @@ void GxGDEW029T5D::drawPagedToWindow(void (*drawCallback)(const void*, const voi
 
 void GxGDEW029T5D::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW029T5D_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW029T5D_BUFFER_SIZE); // white is 0xFF on device
   _writeCommand(0x13);
-  for (uint32_t y = 0; y < GxGDEW029T5D_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEW029T5D_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEW029T5D_HEIGHT; y++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW029T5D_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW029T5D_WIDTH / 8 - 4) && (y > GxGDEW029T5D_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW029T5D_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEW029T5D_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW029T5D_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW029T5D_WIDTH / 8 - 4) && (y > GxGDEW029T5D_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW029T5D_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
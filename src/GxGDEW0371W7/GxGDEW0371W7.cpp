@@ -27,46 +27,9 @@
 GxGDEW0371W7::GxGDEW0371W7(GxIO& io, int8_t rst, int8_t busy)
   : GxEPD(GxGDEW0371W7_WIDTH, GxGDEW0371W7_HEIGHT), IO(io),
     _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
-    _rst(rst), _busy(busy)
+    _rst(rst), _busy(busy), _registers_loaded(registers_unknown)
 {
-}
-
-void GxGDEW0371W7::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW0371W7_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW0371W7_WIDTH - x - 1;
-      y = GxGDEW0371W7_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW0371W7_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW0371W7_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW0371W7_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW0371W7_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW0371W7_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEW0371W7_WIDTH / 8, GxGDEW0371W7_PAGE_HEIGHT, &_current_page);
 }
 
 
@@ -77,8 +40,9 @@ void GxGDEW0371W7::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -97,25 +61,21 @@ void GxGDEW0371W7::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEW0371W7::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_buffer)) ? ~_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _buffer, sizeof(_buffer), 0, GxGDEW0371W7_BUFFER_SIZE, true);
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -127,6 +87,7 @@ void  GxGDEW0371W7::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEW0371W7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_default) mode |= bm_flip_x;
   if (mode & bm_partial_update)
@@ -139,22 +100,25 @@ void GxGDEW0371W7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
       IO.writeCommandTransaction(0x91); // partial in
       _setPartialRamArea(0, 0, GxGDEW0371W7_WIDTH - 1, GxGDEW0371W7_HEIGHT - 1);
       _writeCommand(0x13);
-      for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        _writeData(data);
       }
       _writeCommand(0x12); //display refresh
-      _waitWhileBusy("drawBitmap");
+      _waitWhileBusy("drawBitmap", wait_refresh);
       IO.writeCommandTransaction(0x92); // partial out
     } // leave both controller buffers equal
     delay(GxGDEW0371W7_PU_DELAY); // don't stress this display
@@ -164,33 +128,34 @@ void GxGDEW0371W7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false;
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      _writeData(data);
     }
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW0371W7::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -200,12 +165,9 @@ void GxGDEW0371W7::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW0371W7_WIDTH - 1, GxGDEW0371W7_HEIGHT - 1);
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -213,23 +175,18 @@ void GxGDEW0371W7::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE * 2); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x12); //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW0371W7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation) _rotate(x, y, w, h);
   if (x >= GxGDEW0371W7_WIDTH) return;
@@ -249,15 +206,10 @@ void GxGDEW0371W7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     IO.writeCommandTransaction(0x13);
     for (int16_t y1 = y; y1 <= ye; y1++)
     {
-      for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0371W7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-        IO.writeDataTransaction(~data); // white is 0xFF on device
-      }
+      writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEW0371W7_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
     }
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("updateWindow");
+    _waitWhileBusy("updateWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW0371W7_PU_DELAY); // don't stress this display
@@ -265,6 +217,7 @@ void GxGDEW0371W7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 
 void GxGDEW0371W7::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -311,15 +264,10 @@ void GxGDEW0371W7::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
     IO.writeCommandTransaction(0x13);
     for (int16_t y1 = ys; y1 <= yse; y1++)
     {
-      for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0371W7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-        IO.writeDataTransaction(~data); // white is 0xFF on device
-      }
+      writeBufferData(IO, _buffer, sizeof(_buffer), y1 * (GxGDEW0371W7_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
     }
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("updateToWindow");
+    _waitWhileBusy("updateToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW0371W7_PU_DELAY); // don't stress this display
@@ -335,14 +283,10 @@ uint16_t GxGDEW0371W7::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 {
   x &= 0xFFF8; // byte boundary
   xe = (xe - 1) | 0x0007; // byte boundary - 1
-  IO.writeCommandTransaction(0x90); // partial window
-  IO.writeDataTransaction(x % 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  IO.writeDataTransaction(0x00);
+  {
+    const uint8_t data[] = {uint8_t(x % 256), uint8_t(xe % 256), uint8_t(y / 256), uint8_t(y % 256), uint8_t(ye / 256), uint8_t(ye % 256), 0x00};
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   return (7 + xe - x) / 8; // number of bytes to transfer per line
 }
 
@@ -356,29 +300,38 @@ void GxGDEW0371W7::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void GxGDEW0371W7::_writeDataPGM(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
+void GxGDEW0371W7::_writeCommandDataPGM(uint8_t command, const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
 {
-  for (uint16_t i = 0; i < n; i++)
+  if (fill_with_zeroes <= 0)
   {
-    IO.writeDataTransaction(pgm_read_byte(&*data++));
+    IO.writeCommandDataPGM(command, data, n);
+    return;
   }
-  while (fill_with_zeroes > 0)
+  IO.startTransaction();
+  IO.writeCommand(command);
   {
-    IO.writeDataTransaction(0x00);
-    fill_with_zeroes--;
+    GxIO_Burst burst(IO, true);
+    for (uint16_t i = 0; i < n; i++)
+    {
+      burst.write(pgm_read_byte(&data[i]));
+    }
+    burst.fill(0x00, fill_with_zeroes);
   }
+  IO.endTransaction();
 }
 
-void GxGDEW0371W7::_waitWhileBusy(const char* comment)
+void GxGDEW0371W7::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 10000000)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -395,51 +348,65 @@ void GxGDEW0371W7::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEW0371W7::_wakeUp()
 {
+  _registers_loaded = registers_unknown; // reset or reinitialized below
   // reset required for wakeup
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
+  }
+  {
+    const uint8_t data[] =
+    {
+      0x07,
+      0x07, // VGH=20V,VGL=-20V
+      0x3f, // VDH=15V
+      0x3f // VDL=-15V
+    };
+    IO.writeCommandData(0x01, data, sizeof(data)); // power setting
+  }
+  {
+    const uint8_t data[] =
+    {
+      0x17, // A
+      0x17, // B
+      0x1d // C
+    };
+    IO.writeCommandData(0x06, data, sizeof(data)); // boost soft start
   }
-  _writeCommand(0x01); // power setting
-  _writeData (0x07);
-  _writeData (0x07);   // VGH=20V,VGL=-20V
-  _writeData (0x3f);   // VDH=15V
-  _writeData (0x3f);   // VDL=-15V
-  _writeCommand(0x06); // boost soft start
-  _writeData (0x17);   // A
-  _writeData (0x17);   // B
-  _writeData (0x1d);   // C
   _writeCommand(0x04);
-  _waitWhileBusy("_wakeUp Power On");
-  _writeCommand(0x00); // panel setting
-  _writeData(0x1f);    // LUT from OTP, 128x296
-  _writeCommand(0x61); // resolution setting
-  _writeData (GxGDEW0371W7_WIDTH);
-  _writeData (GxGDEW0371W7_HEIGHT / 256);
-  _writeData (GxGDEW0371W7_HEIGHT % 256);
-  _writeCommand(0x82); // vcom_DC setting
-  _writeData (0x1C);
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x29);    // LUTKW, N2OCP: copy new to old
-  _writeData(0x07);
+  _waitWhileBusy("_wakeUp Power On", wait_power_on);
+  IO.writeCommandData(0x00, 0x1f); // panel setting : LUT from OTP, 128x296
+  {
+    const uint8_t data[] = {GxGDEW0371W7_WIDTH, uint8_t(GxGDEW0371W7_HEIGHT / 256), uint8_t(GxGDEW0371W7_HEIGHT % 256)};
+    IO.writeCommandData(0x61, data, sizeof(data)); // resolution setting
+  }
+  IO.writeCommandData(0x82, 0x1C); // vcom_DC setting
+  {
+    const uint8_t data[] =
+    {
+      0x29, // LUTKW, N2OCP: copy new to old
+      0x07
+    };
+    IO.writeCommandData(0x50, data, sizeof(data)); // VCOM AND DATA INTERVAL SETTING
+  }
   _Init_FullUpdate();
 }
 
 void GxGDEW0371W7::_sleep(void)
 {
   _writeCommand(0x02);      //power off
-  _waitWhileBusy("_sleep Power Off");
+  _waitWhileBusy("_sleep Power Off", wait_power_off);
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData (0xa5);
+    IO.writeCommandData(0x07, 0xa5); // deep sleep
   }
 }
 
@@ -485,32 +452,38 @@ const unsigned char GxGDEW0371W7::lut_25_LUTBD_partial[] PROGMEM =
 
 void GxGDEW0371W7::_Init_FullUpdate(void)
 {
-  _writeCommand(0x00); // panel setting
-  _writeData(0x1f);    // full update LUT from OTP
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x29);    // LUTKW, N2OCP: copy new to old
-  _writeData(0x07);
+  if (_registers_loaded == registers_full_update) return; // unchanged since loaded
+  IO.writeCommandData(0x00, 0x1f); // panel setting : full update LUT from OTP
+  {
+    const uint8_t data[] =
+    {
+      0x29, // LUTKW, N2OCP: copy new to old
+      0x07
+    };
+    IO.writeCommandData(0x50, data, sizeof(data)); // VCOM AND DATA INTERVAL SETTING
+  }
+  _registers_loaded = registers_full_update;
 }
 
 void GxGDEW0371W7::_Init_PartialUpdate(void)
 {
-  _writeCommand(0x00); //panel setting
-  _writeData(0x3f); // partial update LUT from registers
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x39);    // LUTBD, N2OCP: copy new to old
-  _writeData(0x07);
-  _writeCommand(0x20);
-  _writeDataPGM(lut_20_LUTC_partial, sizeof(lut_20_LUTC_partial), 42 - sizeof(lut_20_LUTC_partial));
-  _writeCommand(0x21);
-  _writeDataPGM(lut_21_LUTWW_partial, sizeof(lut_21_LUTWW_partial), 42 - sizeof(lut_21_LUTWW_partial));
-  _writeCommand(0x22);
-  _writeDataPGM(lut_22_LUTKW_partial, sizeof(lut_22_LUTKW_partial), 42 - sizeof(lut_22_LUTKW_partial));
-  _writeCommand(0x23);
-  _writeDataPGM(lut_23_LUTWK_partial, sizeof(lut_23_LUTWK_partial), 42 - sizeof(lut_23_LUTWK_partial));
-  _writeCommand(0x24);
-  _writeDataPGM(lut_24_LUTKK_partial, sizeof(lut_24_LUTKK_partial), 42 - sizeof(lut_24_LUTKK_partial));
-  _writeCommand(0x25);
-  _writeDataPGM(lut_25_LUTBD_partial, sizeof(lut_25_LUTBD_partial), 42 - sizeof(lut_25_LUTBD_partial));
+  if (_registers_loaded == registers_partial_update) return; // unchanged since loaded
+  IO.writeCommandData(0x00, 0x3f); // panel setting : partial update LUT from registers
+  {
+    const uint8_t data[] =
+    {
+      0x39, // LUTBD, N2OCP: copy new to old
+      0x07
+    };
+    IO.writeCommandData(0x50, data, sizeof(data)); // VCOM AND DATA INTERVAL SETTING
+  }
+  _writeCommandDataPGM(0x20, lut_20_LUTC_partial, sizeof(lut_20_LUTC_partial), 42 - sizeof(lut_20_LUTC_partial));
+  _writeCommandDataPGM(0x21, lut_21_LUTWW_partial, sizeof(lut_21_LUTWW_partial), 42 - sizeof(lut_21_LUTWW_partial));
+  _writeCommandDataPGM(0x22, lut_22_LUTKW_partial, sizeof(lut_22_LUTKW_partial), 42 - sizeof(lut_22_LUTKW_partial));
+  _writeCommandDataPGM(0x23, lut_23_LUTWK_partial, sizeof(lut_23_LUTWK_partial), 42 - sizeof(lut_23_LUTWK_partial));
+  _writeCommandDataPGM(0x24, lut_24_LUTKK_partial, sizeof(lut_24_LUTKK_partial), 42 - sizeof(lut_24_LUTKK_partial));
+  _writeCommandDataPGM(0x25, lut_25_LUTBD_partial, sizeof(lut_25_LUTBD_partial), 42 - sizeof(lut_25_LUTBD_partial));
+  _registers_loaded = registers_partial_update;
 }
 
 void GxGDEW0371W7::drawPaged(void (*drawCallback)(void))
@@ -519,28 +492,17 @@ void GxGDEW0371W7::drawPaged(void (*drawCallback)(void))
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0371W7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0371W7_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0371W7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0371W7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW0371W7_PAGE_HEIGHT * (GxGDEW0371W7_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -550,28 +512,17 @@ void GxGDEW0371W7::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0371W7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0371W7_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0371W7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0371W7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW0371W7_PAGE_HEIGHT * (GxGDEW0371W7_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -581,28 +532,17 @@ void GxGDEW0371W7::drawPaged(void (*drawCallback)(const void*), const void* p)
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0371W7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0371W7_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0371W7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0371W7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW0371W7_PAGE_HEIGHT * (GxGDEW0371W7_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -612,28 +552,17 @@ void GxGDEW0371W7::drawPaged(void (*drawCallback)(const void*, const void*), con
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // 0xFF is white
   _writeCommand(0x13);
   for (_current_page = 0; _current_page < GxGDEW0371W7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0371W7_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW0371W7_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW0371W7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _writeData(~data); // white is 0xFF on device
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_buffer, GxGDEW0371W7_PAGE_HEIGHT * (GxGDEW0371W7_WIDTH / 8), true);
   }
   _current_page = -1;
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -683,22 +612,17 @@ void GxGDEW0371W7::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback();
+        drawPage(drawCallback);
         uint16_t ys = yds % GxGDEW0371W7_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0371W7_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW0371W7_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW0371W7_PU_DELAY); // don't stress this display
@@ -729,22 +653,17 @@ void GxGDEW0371W7::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEW0371W7_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0371W7_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW0371W7_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW0371W7_PU_DELAY); // don't stress this display
@@ -775,22 +694,17 @@ void GxGDEW0371W7::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p);
+        drawPage(drawCallback, p);
         uint16_t ys = yds % GxGDEW0371W7_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0371W7_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW0371W7_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW0371W7_PU_DELAY); // don't stress this display
@@ -821,22 +735,17 @@ void GxGDEW0371W7::drawPagedToWindow(void (*drawCallback)(const void*, const voi
       if (yde > yds)
       {
         fillScreen(GxEPD_WHITE);
-        drawCallback(p1, p2);
+        drawPage(drawCallback, p1, p2);
         uint16_t ys = yds % GxGDEW0371W7_PAGE_HEIGHT;
         for (int16_t y1 = yds; y1 <= yde; ys++, y1++)
         {
-          for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-          {
-            uint16_t idx = ys * (GxGDEW0371W7_WIDTH / 8) + x1;
-            uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00; // white is 0x00 in buffer
-            IO.writeDataTransaction(~data); // white is 0xFF on device
-          }
+          writeBufferData(IO, _buffer, sizeof(_buffer), ys * (GxGDEW0371W7_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
         }
       }
     }
     _current_page = -1;
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawPagedToWindow");
+    _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   } // leave both controller buffers equal
   delay(GxGDEW0371W7_PU_DELAY); // don't stress this display
@@ -844,28 +753,29 @@ void GxGDEW0371W7::drawPagedToWindow(void (*drawCallback)(const void*, const voi
 
 void GxGDEW0371W7::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t i = 0; i < GxGDEW0371W7_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW0371W7_BUFFER_SIZE); // white is 0xFF on device
   _writeCommand(0x13);
-  for (uint32_t y = 0; y < GxGDEW0371W7_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEW0371W7_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEW0371W7_HEIGHT; y++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW0371W7_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW0371W7_WIDTH / 8 - 4) && (y > GxGDEW0371W7_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW0371W7_HEIGHT - 33)) data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < GxGDEW0371W7_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW0371W7_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW0371W7_WIDTH / 8 - 4) && (y > GxGDEW0371W7_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW0371W7_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _writeCommand(0x12); //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
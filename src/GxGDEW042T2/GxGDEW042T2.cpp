@@ -24,49 +24,38 @@
 #endif
 
 GxGDEW042T2::GxGDEW042T2(GxIO& io, int8_t rst, int8_t busy)
-  : GxEPD(GxGDEW042T2_WIDTH, GxGDEW042T2_HEIGHT), IO(io),
+  : GxEPD(GxGDEW042T2_WIDTH, GxGDEW042T2_HEIGHT), _buffer(0), _buffer_bytes(0), IO(io),
     _current_page(-1), _initial(true), _using_partial_mode(false), _diag_enabled(false),
-    _rst(rst), _busy(busy)
+    _rst(rst), _busy(busy), _registers_loaded(registers_unknown), _async(false), _async_state(async_idle)
 {
+#if !defined(GxGDEW042T2_EXTERNAL_BUFFER)
+  _buffer = _class_buffer;
+  _buffer_bytes = sizeof(_class_buffer);
+  setBufferLayout(buffer_bw, _buffer, 0, _buffer_bytes, GxGDEW042T2_WIDTH / 8, GxGDEW042T2_PAGE_HEIGHT, &_current_page);
+#endif
 }
 
-void GxGDEW042T2::drawPixel(int16_t x, int16_t y, uint16_t color)
+GxGDEW042T2::GxGDEW042T2(GxIO& io, int8_t rst, int8_t busy, uint8_t* buffer, uint32_t size) : GxGDEW042T2(io, rst, busy)
 {
+  _setBuffer(buffer, size);
+}
 
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW042T2_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW042T2_WIDTH - x - 1;
-      y = GxGDEW042T2_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW042T2_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW042T2_WIDTH / 8;
-  if (_current_page < 0)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW042T2_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW042T2_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW042T2_WIDTH / 8;
-  }
+void GxGDEW042T2::init(uint32_t serial_diag_bitrate, uint8_t* buffer, uint32_t size)
+{
+  _setBuffer(buffer, size);
+  init(serial_diag_bitrate);
+}
 
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+void GxGDEW042T2::_setBuffer(uint8_t* buffer, uint32_t size)
+{
+  // whole rows, at most the screen
+  uint16_t rows = gx_int32_min(size / (GxGDEW042T2_WIDTH / 8), GxGDEW042T2_HEIGHT);
+  if (!buffer || !rows) return;
+  _buffer = buffer;
+  _buffer_bytes = uint32_t(rows) * (GxGDEW042T2_WIDTH / 8);
+  setBufferLayout(buffer_bw, _buffer, 0, _buffer_bytes, GxGDEW042T2_WIDTH / 8, rows, &_current_page);
+  clearDirty();
+  invalidateShadow();
 }
 
 void GxGDEW042T2::init(uint32_t serial_diag_bitrate)
@@ -76,8 +65,9 @@ void GxGDEW042T2::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -92,26 +82,23 @@ void GxGDEW042T2::init(uint32_t serial_diag_bitrate)
 
 void GxGDEW042T2::fillScreen(uint16_t color)
 {
-  uint8_t data = (color == GxEPD_BLACK) ? 0xFF : 0x00;
-  for (uint16_t x = 0; x < sizeof(_buffer); x++)
-  {
-    _buffer[x] = data;
-  }
+  fillBuffers((color == GxEPD_BLACK) ? 0xFF : 0x00, 0x00);
+  bufferFilled(color);
 }
 
 void GxGDEW042T2::update(void)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-  {
-    uint8_t data = i < sizeof(_buffer) ? _buffer[i] : 0x00;
-    IO.writeDataTransaction(~data);
-  }
+  writeBufferData(IO, _buffer, _buffer_bytes, 0, GxGDEW042T2_BUFFER_SIZE, true);
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("update");
+  if (_startAsync(_initial ? async_refresh_first : async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("update", wait_full_refresh);
 #if 0
   if (_initial)
   {
@@ -119,13 +106,9 @@ void GxGDEW042T2::update(void)
     // use second full refresh to init second controller buffer
     // needed for subsequent partial updates
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      uint8_t data = i < sizeof(_buffer) ? _buffer[i] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    writeBufferData(IO, _buffer, _buffer_bytes, 0, GxGDEW042T2_BUFFER_SIZE, true);
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("update");
+    _waitWhileBusy("update", wait_full_refresh);
   }
 #else
   // avoid double full refresh after deep sleep wakeup
@@ -134,17 +117,8 @@ void GxGDEW042T2::update(void)
     _initial = false;
     // use full screen partial refresh to init second controller buffer
     // needed for subsequent partial updates
-    _Init_PartialUpdate();
-    IO.writeCommandTransaction(0x91); // partial in
-    _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-    IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      uint8_t data = i < sizeof(_buffer) ? _buffer[i] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
-    IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("update");
+    _refreshInitial();
+    _waitWhileBusy("update initial", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
 #endif
@@ -159,6 +133,8 @@ void  GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 
 void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
+  finish();
   if (_current_page != -1) return;
   if (mode & bm_default) mode |= bm_normal;
   if (mode & bm_partial_update)
@@ -170,85 +146,97 @@ void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042T2_WIDTH - 1, GxGDEW042T2_HEIGHT - 1);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x92); // partial out
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     // update erase buffer
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042T2_WIDTH - 1, GxGDEW042T2_HEIGHT - 1);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x92); // partial out
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
   }
   else
   {
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     if (_initial)
     {
       _initial = false;
       IO.writeCommandTransaction(0x13);
-      for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
       {
-        uint8_t data = 0xFF; // white is 0xFF on device
-        if (i < size)
+        GxIO_Burst burst(IO);
+        for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
         {
+          uint8_t data = 0xFF; // white is 0xFF on device
+          if (i < size)
+          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[i]);
+            data = pgm_read_byte(&bitmap[i]);
 #else
-          data = bitmap[i];
+            data = bitmap[i];
 #endif
-          if (mode & bm_invert) data = ~data;
+            if (mode & bm_invert) data = ~data;
+          }
+          burst.write(data);
         }
-        IO.writeDataTransaction(data);
       }
       IO.writeCommandTransaction(0x12);      //display refresh
-      _waitWhileBusy("drawBitmap");
+      _waitWhileBusy("drawBitmap", wait_refresh);
     }
     _sleep();
   }
@@ -256,6 +244,8 @@ void GxGDEW042T2::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 
 void GxGDEW042T2::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
+  finish();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -266,37 +256,31 @@ void GxGDEW042T2::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042T2_WIDTH - 1, GxGDEW042T2_HEIGHT - 1);
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042T2_BUFFER_SIZE);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042T2_BUFFER_SIZE);
     IO.writeCommandTransaction(0x92); // partial out
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
   }
   else
   {
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042T2_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF);
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042T2_BUFFER_SIZE);
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW042T2::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   if (using_rotation)
   {
     switch (getRotation())
@@ -324,41 +308,102 @@ void GxGDEW042T2::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   uint16_t xe = gx_uint16_min(GxGDEW042T2_WIDTH, x + w) - 1;
   uint16_t ye = gx_uint16_min(GxGDEW042T2_HEIGHT, y + h) - 1;
   // x &= 0xFFF8; // byte boundary, not needed here
-  uint16_t xs_bx = x / 8;
-  uint16_t xe_bx = (xe + 7) / 8;
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _Init_PartialUpdate();
-  IO.writeCommandTransaction(0x91); // partial in
-  _setPartialRamArea(x, y, xe, ye);
-  IO.writeCommandTransaction(0x13);
-  for (int16_t y1 = y; y1 <= ye; y1++)
+  _writeWindow(x, y, xe, ye);
+  IO.writeCommandTransaction(0x12); //display refresh
+  if (_startAsync(async_partial_refresh, wait_partial_refresh))
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    _async_x = x;
+    _async_y = y;
+    _async_xe = xe;
+    _async_ye = ye;
+    return;
   }
-  IO.writeCommandTransaction(0x92); // partial out
-  IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("updateWindow");
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
+  _writeWindow(x, y, xe, ye);
+}
+
+void GxGDEW042T2::_writeWindow(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye)
+{
+  uint16_t xs_bx = x / 8;
+  uint16_t xe_bx = (xe + 7) / 8;
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x13);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    writeBufferData(IO, _buffer, _buffer_bytes, y1 * (GxGDEW042T2_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
   }
   IO.writeCommandTransaction(0x92); // partial out
 }
 
+void GxGDEW042T2::updateAsync()
+{
+  _async = true;
+  update();
+  _async = false;
+}
+
+void GxGDEW042T2::updateWindowAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
+{
+  _async = true;
+  updateWindow(x, y, w, h, using_rotation);
+  _async = false;
+}
+
+bool GxGDEW042T2::isBusy()
+{
+  switch (_async_state)
+  {
+    case async_refresh:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW042T2_BUSY_TIMEOUT)) return true;
+      if (deferPowerOff()) break;
+      _powerOff();
+      startBusyPoll(wait_power_off);
+      _async_state = async_power_off;
+      return true;
+    case async_refresh_first:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW042T2_BUSY_TIMEOUT)) return true;
+      _initial = false;
+      _refreshInitial();
+      holdBuffer(false);
+      startBusyPoll(wait_refresh);
+      _async_state = async_refresh_initial;
+      return true;
+    case async_refresh_initial:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW042T2_BUSY_TIMEOUT)) return true;
+      IO.writeCommandTransaction(0x92); // partial out
+      if (deferPowerOff()) break;
+      _powerOff();
+      startBusyPoll(wait_power_off);
+      _async_state = async_power_off;
+      return true;
+    case async_power_off:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW042T2_BUSY_TIMEOUT)) return true;
+      _deepSleep();
+      break;
+    case async_partial_refresh:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW042T2_BUSY_TIMEOUT)) return true;
+      _writeWindow(_async_x, _async_y, _async_xe, _async_ye);
+      holdBuffer(false);
+      break;
+  }
+  _async_state = async_idle;
+  return false;
+}
+
+bool GxGDEW042T2::_startAsync(uint8_t state, busy_wait wait)
+{
+  if (!_async) return false;
+  startBusyPoll(wait);
+  _async_state = state;
+  // the buffer is sent again after the refresh
+  if ((state == async_refresh_first) || (state == async_partial_refresh)) holdBuffer(true);
+  return true;
+}
+
 void GxGDEW042T2::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h)
 {
   //Serial.printf("_writeToWindow(%d, %d, %d, %d, %d, %d)\n", xs, ys, xd, yd, w, h);
@@ -377,12 +422,7 @@ void GxGDEW042T2::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   IO.writeCommandTransaction(0x13);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    writeBufferData(IO, bufferBlack(), bufferSize(), y1 * (GxGDEW042T2_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
   }
   delay(2);
   IO.writeCommandTransaction(0x92); // partial out
@@ -390,6 +430,9 @@ void GxGDEW042T2::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
 
 void GxGDEW042T2::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
+  finish();
+  if (!_buffer) return; // no buffer bound
   if (using_rotation)
   {
     switch (getRotation())
@@ -421,43 +464,51 @@ void GxGDEW042T2::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   _Init_PartialUpdate();
   _writeToWindow(xs, ys, xd, yd, w, h);
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   delay(500); // don't stress this display
 }
 
 void GxGDEW042T2::powerDown()
 {
-  _sleep();
+  finish();
+  _sleep(false);
 }
 
 uint16_t GxGDEW042T2::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye)
 {
   x &= 0xFFF8; // byte boundary
   xe = (xe - 1) | 0x0007; // byte boundary - 1
-  IO.writeCommandTransaction(0x90); // partial window
-  IO.writeDataTransaction(x / 256);
-  IO.writeDataTransaction(x % 256);
-  IO.writeDataTransaction(xe / 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  IO.writeDataTransaction(0x01); // don't see any difference
+  {
+    const uint8_t data[] =
+    {
+      uint8_t(x / 256),
+      uint8_t(x % 256),
+      uint8_t(xe / 256),
+      uint8_t(xe % 256),
+      uint8_t(y / 256),
+      uint8_t(y % 256),
+      uint8_t(ye / 256),
+      uint8_t(ye % 256),
+      0x01 // don't see any difference
+    };
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   //IO.writeDataTransaction(0x00); // don't see any difference
   return (7 + xe - x) / 8; // number of bytes to transfer
 }
 
-void GxGDEW042T2::_waitWhileBusy(const char* comment)
+void GxGDEW042T2::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   { //=0 BUSY
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > GxGDEW042T2_BUSY_TIMEOUT)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -474,161 +525,181 @@ void GxGDEW042T2::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEW042T2::_wakeUp(void)
 {
+  if (isKeptPowered())
+  {
+    _Init_FullUpdate();
+    return;
+  }
+  _registers_loaded = registers_unknown; // reset or reinitialized below
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
   }
-  IO.writeCommandTransaction(0x01); // POWER SETTING
-  IO.writeDataTransaction(0x03);   // VDS_EN, VDG_EN internal
-  IO.writeDataTransaction(0x00);   // VCOM_HV, VGHL_LV=16V
-  IO.writeDataTransaction(0x2b);   // VDH=11V
-  IO.writeDataTransaction(0x2b);   // VDL=11V
-  IO.writeCommandTransaction(0x06); // boost soft start
-  IO.writeDataTransaction(0x17);   // A
-  IO.writeDataTransaction(0x17);   // B
-  IO.writeDataTransaction(0x17);   // C
-  IO.writeCommandTransaction(0x00); // panel setting
-  IO.writeDataTransaction(0x3f);    // 300x400 B/W mode, LUT set by register
-  IO.writeCommandTransaction(0x30); // PLL setting
-  IO.writeDataTransaction(0x3a);   // 3a 100HZ   29 150Hz 39 200HZ 31 171HZ
-  IO.writeCommandTransaction(0x61); // resolution setting
-  IO.writeDataTransaction(WIDTH / 256);
-  IO.writeDataTransaction(WIDTH % 256);
-  IO.writeDataTransaction(HEIGHT / 256);
-  IO.writeDataTransaction(HEIGHT % 256);
-  IO.writeCommandTransaction(0x82); // vcom_DC setting
-  //IO.writeDataTransaction(0x08);   // -0.1 + 8 * -0.05 = -0.5V from demo
-  IO.writeDataTransaction(0x12);   // -0.1 + 18 * -0.05 = -1.0V from OTP, slightly better
+  {
+    const uint8_t data[] =
+    {
+      0x03, // VDS_EN, VDG_EN internal
+      0x00, // VCOM_HV, VGHL_LV=16V
+      0x2b, // VDH=11V
+      0x2b // VDL=11V
+    };
+    IO.writeCommandData(0x01, data, sizeof(data)); // POWER SETTING
+  }
+  {
+    const uint8_t data[] =
+    {
+      0x17, // A
+      0x17, // B
+      0x17 // C
+    };
+    IO.writeCommandData(0x06, data, sizeof(data)); // boost soft start
+  }
+  IO.writeCommandData(0x00, 0x3f); // panel setting : 300x400 B/W mode, LUT set by register
+  IO.writeCommandData(0x30, 0x3a); // PLL setting : 3a 100HZ   29 150Hz 39 200HZ 31 171HZ
+  {
+    const uint8_t data[] = {uint8_t(WIDTH / 256), uint8_t(WIDTH % 256), uint8_t(HEIGHT / 256), uint8_t(HEIGHT % 256)};
+    IO.writeCommandData(0x61, data, sizeof(data)); // resolution setting
+  }
+  //IO.writeCommandData(0x82, 0x08); // -0.1 + 8 * -0.05 = -0.5V from demo
+  IO.writeCommandData(0x82, 0x12); // vcom_DC setting : -0.1 + 18 * -0.05 = -1.0V from OTP, slightly better
   //IO.writeDataTransaction(0x1c);   // -0.1 + 28 * -0.05 = -1.5V test, worse
-  IO.writeCommandTransaction(0x50); // VCOM AND DATA INTERVAL SETTING
-  //IO.writeDataTransaction(0x97);    // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-  IO.writeDataTransaction(0xd7);    // border floating to avoid flashing
+  //IO.writeCommandData(0x50, 0x97); // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  IO.writeCommandData(0x50, 0xd7); // VCOM AND DATA INTERVAL SETTING : border floating to avoid flashing
   IO.writeCommandTransaction(0x04);
-  _waitWhileBusy("Power On");
+  _waitWhileBusy("Power On", wait_power_on);
   _Init_FullUpdate();
 }
 
-void GxGDEW042T2::_sleep(void)
+void GxGDEW042T2::_sleep(bool deferrable)
 {
-  IO.writeCommandTransaction(0x50); // border floating
-  IO.writeDataTransaction(0x17);
+  if (deferrable && deferPowerOff()) return; // kept powered, see GxEPD::setPowerPolicy()
+  _powerOff();
+  _waitWhileBusy("Power Off", wait_power_off);
+  _deepSleep();
+}
+
+void GxGDEW042T2::_powerOff(void)
+{
+  IO.writeCommandData(0x50, 0x17); // border floating
   IO.writeCommandTransaction(0x02); // power off
-  _waitWhileBusy("Power Off");
+}
+
+void GxGDEW042T2::_deepSleep(void)
+{
+  onPowerOff();
   if (_rst >= 0)
   {
-    IO.writeCommandTransaction(0x07); // deep sleep
-    IO.writeDataTransaction(0xA5);
+    IO.writeCommandData(0x07, 0xA5); // deep sleep
   }
 }
 
+void GxGDEW042T2::_refreshInitial()
+{
+  _Init_PartialUpdate();
+  IO.writeCommandTransaction(0x91); // partial in
+  _setPartialRamArea(0, 0, WIDTH, HEIGHT);
+  IO.writeCommandTransaction(0x13);
+  writeBufferData(IO, _buffer, _buffer_bytes, 0, GxGDEW042T2_BUFFER_SIZE, true);
+  IO.writeCommandTransaction(0x12);      //display refresh
+}
+
 void GxGDEW042T2::drawPaged(void (*drawCallback)(void))
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(bufferBlack(), uint32_t(pageRows(_current_page)) * (GxGDEW042T2_WIDTH / 8), true);
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
 void GxGDEW042T2::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(bufferBlack(), uint32_t(pageRows(_current_page)) * (GxGDEW042T2_WIDTH / 8), true);
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
 void GxGDEW042T2::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(bufferBlack(), uint32_t(pageRows(_current_page)) * (GxGDEW042T2_WIDTH / 8), true);
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
 void GxGDEW042T2::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW042T2_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042T2_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042T2_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(bufferBlack(), uint32_t(pageRows(_current_page)) * (GxGDEW042T2_WIDTH / 8), true);
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -655,7 +726,9 @@ void GxGDEW042T2::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -663,42 +736,46 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      drawPage(drawCallback);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      drawPage(drawCallback);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
+  endPages();
 }
 
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -706,44 +783,48 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       //fillScreen(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       //fillScreen(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
+  endPages();
 }
 
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -751,42 +832,46 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      drawPage(drawCallback, p);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      drawPage(drawCallback, p);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
+  endPages();
 }
 
 void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_buffer) return; // no buffer bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -794,107 +879,101 @@ void GxGDEW042T2::drawPagedToWindow(void (*drawCallback)(const void*, const void
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      drawPage(drawCallback, p1, p2);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   // update erase buffer
-  for (_current_page = 0; _current_page < GxGDEW042T2_PAGES; _current_page++)
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW042T2_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW042T2_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW042T2_PAGE_HEIGHT;
+      drawPage(drawCallback, p1, p2);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   delay(2);
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   _current_page = -1;
+  endPages();
 }
 
 void GxGDEW042T2::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
+  finish();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x13);
-  for (uint32_t y = 0; y < GxGDEW042T2_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEW042T2_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEW042T2_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW042T2_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW042T2_WIDTH / 8 - 4) && (y > GxGDEW042T2_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW042T2_HEIGHT - 33)) data = 0x00;
-      IO.writeDataTransaction(data);
+      for (uint32_t x = 0; x < GxGDEW042T2_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW042T2_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW042T2_WIDTH / 8 - 4) && (y > GxGDEW042T2_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW042T2_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
 
-void GxGDEW042T2::_writeDataPGM(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
+void GxGDEW042T2::_writeCommandDataPGM(uint8_t command, const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
 {
-  for (uint16_t i = 0; i < n; i++)
+  if (fill_with_zeroes <= 0)
   {
-    IO.writeDataTransaction(pgm_read_byte(&*data++));
+    IO.writeCommandDataPGM(command, data, n);
+    return;
   }
-  while (fill_with_zeroes > 0)
+  IO.startTransaction();
+  IO.writeCommand(command);
   {
-    IO.writeDataTransaction(0x00);
-    fill_with_zeroes--;
+    GxIO_Burst burst(IO, true);
+    for (uint16_t i = 0; i < n; i++)
+    {
+      burst.write(pgm_read_byte(&data[i]));
+    }
+    burst.fill(0x00, fill_with_zeroes);
   }
+  IO.endTransaction();
 }
 
 void GxGDEW042T2::_Init_FullUpdate()
 {
+  if (_registers_loaded == registers_full_update) return; // unchanged since loaded
   //IO.writeCommandTransaction(0x00);
   //IO.writeDataTransaction(0x1f); // LUT from OTP Pixel with B/W.
-  IO.writeCommandTransaction(0x00);
-  IO.writeDataTransaction(0x3F); //300x400 B/W mode, LUT set by register
-  unsigned int count;
-  IO.writeCommandTransaction(0x20); //vcom
-  for (count = 0; count < 44; count++)
-  {
-    IO.writeDataTransaction(lut_vcom0_full[count]);
-  }
-  IO.writeCommandTransaction(0x21); //ww --
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_ww_full[count]);
-  }
-  IO.writeCommandTransaction(0x22); //bw r
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_bw_full[count]);
-  }
-  IO.writeCommandTransaction(0x23); //wb w
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_wb_full[count]);
-  }
-  IO.writeCommandTransaction(0x24); //bb b
-  for (count = 0; count < 42; count++)
-  {
-    IO.writeDataTransaction(lut_bb_full[count]);
-  }
+  IO.writeCommandData(0x00, 0x3F); // 300x400 B/W mode, LUT set by register
+  IO.writeCommandData(0x20, lut_vcom0_full, 44); //vcom
+  IO.writeCommandData(0x21, lut_ww_full, 42); //ww --
+  IO.writeCommandData(0x22, lut_bw_full, 42); //bw r
+  IO.writeCommandData(0x23, lut_wb_full, 42); //wb w
+  IO.writeCommandData(0x24, lut_bb_full, 42); //bb b
+  _registers_loaded = registers_full_update;
 }
 
 const unsigned char GxGDEW042T2::lut_vcom0_full[] =
@@ -1008,16 +1087,12 @@ const unsigned char GxGDEW042T2::lut_24_bb_partial[] PROGMEM =
 
 void GxGDEW042T2::_Init_PartialUpdate()
 {
-  IO.writeCommandTransaction(0x00);
-  IO.writeDataTransaction(0x3F); //300x400 B/W mode, LUT set by register
-  IO.writeCommandTransaction(0x20);
-  _writeDataPGM(lut_20_vcom0_partial, sizeof(lut_20_vcom0_partial), 44 - sizeof(lut_20_vcom0_partial));
-  IO.writeCommandTransaction(0x21);
-  _writeDataPGM(lut_21_ww_partial, sizeof(lut_21_ww_partial), 42 - sizeof(lut_21_ww_partial));
-  IO.writeCommandTransaction(0x22);
-  _writeDataPGM(lut_22_bw_partial, sizeof(lut_22_bw_partial), 42 - sizeof(lut_22_bw_partial));
-  IO.writeCommandTransaction(0x23);
-  _writeDataPGM(lut_23_wb_partial, sizeof(lut_23_wb_partial), 42 - sizeof(lut_23_wb_partial));
-  IO.writeCommandTransaction(0x24);
-  _writeDataPGM(lut_24_bb_partial, sizeof(lut_24_bb_partial), 42 - sizeof(lut_24_bb_partial));
+  if (_registers_loaded == registers_partial_update) return; // unchanged since loaded
+  IO.writeCommandData(0x00, 0x3F); // 300x400 B/W mode, LUT set by register
+  _writeCommandDataPGM(0x20, lut_20_vcom0_partial, sizeof(lut_20_vcom0_partial), 44 - sizeof(lut_20_vcom0_partial));
+  _writeCommandDataPGM(0x21, lut_21_ww_partial, sizeof(lut_21_ww_partial), 42 - sizeof(lut_21_ww_partial));
+  _writeCommandDataPGM(0x22, lut_22_bw_partial, sizeof(lut_22_bw_partial), 42 - sizeof(lut_22_bw_partial));
+  _writeCommandDataPGM(0x23, lut_23_wb_partial, sizeof(lut_23_wb_partial), 42 - sizeof(lut_23_wb_partial));
+  _writeCommandDataPGM(0x24, lut_24_bb_partial, sizeof(lut_24_bb_partial), 42 - sizeof(lut_24_bb_partial));
+  _registers_loaded = registers_partial_update;
 }
@@ -27,6 +27,10 @@
 #define GxGDEW042T2_PAGE_HEIGHT (GxGDEW042T2_HEIGHT / GxGDEW042T2_PAGES)
 #define GxGDEW042T2_PAGE_SIZE (GxGDEW042T2_BUFFER_SIZE / GxGDEW042T2_PAGES)
 
+// uncomment to leave the buffer out of the class, a buffer of caller memory must then be bound at construction or init(),
+// updates and drawPaged() do nothing while no buffer is bound
+//#define GxGDEW042T2_EXTERNAL_BUFFER
+
 class GxGDEW042T2 : public GxEPD
 {
   public:
@@ -37,8 +41,11 @@ class GxGDEW042T2 : public GxEPD
 #else
     GxGDEW042T2(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // with a buffer of caller memory, e.g. in PSRAM or a static arena, of size bytes, replaces the buffer of the class :
+    // GxGDEW042T2_BUFFER_SIZE for full screen, else pages of size / (GxGDEW042T2_WIDTH / 8) rows for drawPaged()
+    GxGDEW042T2(GxIO& io, int8_t rst, int8_t busy, uint8_t* buffer, uint32_t size);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
+    void init(uint32_t serial_diag_bitrate, uint8_t* buffer, uint32_t size); // binds the buffer, e.g. allocated in setup()
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
     // to buffer, may be cropped, drawPixel() used, update needed
@@ -52,12 +59,29 @@ class GxGDEW042T2 : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW042T2_PAGES times
+    // non-blocking update, refresh and power off are completed by isBusy() or finish()
+    // the first update after init or deep sleep writes the second controller buffer from the buffer after the refresh
+    void updateAsync();
+    // non-blocking partial update, refresh and second buffer write are completed by isBusy() or finish()
+    // drawing to the buffer before the second buffer write is sent completes it first, as finish()
+    void updateWindowAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true);
+    bool isBusy();
+    // paged drawing, for limited RAM, drawCallback() is called GxGDEW042T2_PAGES times, or once per page of setPageBuffer()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
     void drawPaged(void (*drawCallback)(const void*), const void*);
     void drawPaged(void (*drawCallback)(const void*, const void*), const void*, const void*);
+    // non-blocking paged drawing, refresh and power off are completed by isBusy() or finish()
+    void drawPagedAsync(void (*drawCallback)(void)) {_async = true; drawPaged(drawCallback); _async = false;};
+    void drawPagedAsync(void (*drawCallback)(uint32_t), uint32_t p) {_async = true; drawPaged(drawCallback, p); _async = false;};
+    void drawPagedAsync(void (*drawCallback)(const void*), const void* p) {_async = true; drawPaged(drawCallback, p); _async = false;};
+    void drawPagedAsync(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
+    {
+      _async = true;
+      drawPaged(drawCallback, p1, p2);
+      _async = false;
+    };
     // paged drawing to screen rectangle at (x,y) using partial update
     void drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h);
     void drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t);
@@ -75,24 +99,41 @@ class GxGDEW042T2 : public GxEPD
     void _writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h);
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
-    void _sleep(void);
-    void _waitWhileBusy(const char* comment = 0);
+    void _sleep(bool deferrable = true); // deferrable by the power policy
+    void _powerOff();
+    void _deepSleep();
+    void _refreshInitial();
+    void _setBuffer(uint8_t* buffer, uint32_t size);
+    void _writeWindow(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
+    bool _startAsync(uint8_t state, busy_wait wait);
     void _Init_FullUpdate();
     void _Init_PartialUpdate();
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
-    void _writeDataPGM(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes = 0);
+    void _writeCommandDataPGM(uint8_t command, const uint8_t* data, uint16_t n, int16_t fill_with_zeroes = 0);
   private:
+#if !defined(GxGDEW042T2_EXTERNAL_BUFFER)
 #if defined(__AVR)
-    uint8_t _buffer[GxGDEW042T2_PAGE_SIZE];
+    uint8_t _class_buffer[GxGDEW042T2_PAGE_SIZE];
 #else
-    uint8_t _buffer[GxGDEW042T2_BUFFER_SIZE];
+    uint8_t _class_buffer[GxGDEW042T2_BUFFER_SIZE];
+#endif
 #endif
+    uint8_t* _buffer; // the buffer of the class or of caller memory, 0 if none bound
+    uint32_t _buffer_bytes;
     GxIO& IO;
     int16_t _current_page;
     bool _initial, _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
     int8_t _busy;
+    register_set _registers_loaded; // by _Init_FullUpdate() or _Init_PartialUpdate()
+    // refresh state machine of non-blocking operations
+    // async_refresh_first : refresh of the first update(), the second controller buffer is written from the buffer after it
+    enum {async_idle, async_refresh, async_refresh_first, async_refresh_initial, async_power_off, async_partial_refresh};
+    bool _async; // next refresh non-blocking
+    uint8_t _async_state;
+    uint16_t _async_x, _async_y, _async_xe, _async_ye; // window of async_partial_refresh
     static const unsigned char lut_vcom0_full[];
     static const unsigned char lut_ww_full[];
     static const unsigned char lut_bw_full[];
@@ -33,53 +33,7 @@ GxGDEW042Z15::GxGDEW042Z15(GxIO& io, int8_t rst, int8_t busy)
     _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEW042Z15::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW042Z15_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW042Z15_WIDTH - x - 1;
-      y = GxGDEW042Z15_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW042Z15_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW042Z15_WIDTH / 8;
-  if (_current_page < 0)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW042Z15_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW042Z15_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW042Z15_WIDTH / 8;
-  }
-
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+  setBufferLayout(buffer_3c, _black_buffer, _red_buffer, sizeof(_black_buffer), GxGDEW042Z15_WIDTH / 8, GxGDEW042Z15_PAGE_HEIGHT, &_current_page);
 }
 
 void GxGDEW042Z15::init(uint32_t serial_diag_bitrate)
@@ -89,8 +43,9 @@ void GxGDEW042Z15::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -116,27 +71,21 @@ void GxGDEW042Z15::fillScreen(uint16_t color)
     _black_buffer[x] = black;
     _red_buffer[x] = red;
   }
+  bufferFilled(color);
 }
 
 void GxGDEW042Z15::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
-  for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-  {
-    uint8_t data = i < sizeof(_black_buffer) ? _black_buffer[i] : 0x00;
-    IO.writeDataTransaction(~data);
-  }
+  writeBufferData(IO, _black_buffer, sizeof(_black_buffer), 0, GxGDEW042Z15_BUFFER_SIZE, true);
   IO.writeCommandTransaction(0x13); // red
-  for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-  {
-    uint8_t data = i < sizeof(_red_buffer) ? _red_buffer[i] : 0x00;
-    IO.writeDataTransaction(~data);
-  }
+  writeBufferData(IO, _red_buffer, sizeof(_red_buffer), 0, GxGDEW042Z15_BUFFER_SIZE, true);
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -148,11 +97,13 @@ void  GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEW042Z15::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size)
 {
+  invalidateShadow();
   drawPicture(black_bitmap, red_bitmap, black_size, red_size, bm_normal);
 }
 
 void GxGDEW042Z15::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_partial_update)
   {
@@ -162,37 +113,43 @@ void GxGDEW042Z15::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // 0xFF is white
-      if (i < black_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // 0xFF is white
+        if (i < black_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
+          data = pgm_read_byte(&black_bitmap[i]);
 #else
-        data = black_bitmap[i];
+          data = black_bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // 0xFF is white
-      if (i < red_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // 0xFF is white
+        if (i < red_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
+          data = pgm_read_byte(&red_bitmap[i]);
 #else
-        data = red_bitmap[i];
+          data = red_bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x12); //display refresh
-    _waitWhileBusy("drawPicture");
+    _waitWhileBusy("drawPicture", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -200,43 +157,50 @@ void GxGDEW042Z15::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     _using_partial_mode = false;
     _wakeUp();
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < black_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < black_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black_bitmap[i]);
+          data = pgm_read_byte(&black_bitmap[i]);
 #else
-        data = black_bitmap[i];
+          data = black_bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < red_size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < red_size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&red_bitmap[i]);
+          data = pgm_read_byte(&red_bitmap[i]);
 #else
-        data = red_bitmap[i];
+          data = red_bitmap[i];
 #endif
-        if (mode & bm_invert_red) data = ~data;
+          if (mode & bm_invert_red) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x12); //display refresh
-    _waitWhileBusy("drawPicture");
+    _waitWhileBusy("drawPicture", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_default) mode |= bm_normal;
   if (mode & bm_partial_update)
@@ -247,28 +211,28 @@ void GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042Z15_BUFFER_SIZE); // 0xFF is white
     IO.writeCommandTransaction(0x92); // partial out
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -276,33 +240,34 @@ void GxGDEW042Z15::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if (i < size)
+      GxIO_Burst burst(IO);
+      for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        burst.write(data);
       }
-      IO.writeDataTransaction(data);
     }
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042Z15_BUFFER_SIZE); // 0xFF is white
     IO.writeCommandTransaction(0x12); //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW042Z15::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -312,17 +277,11 @@ void GxGDEW042Z15::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042Z15_BUFFER_SIZE); // 0xFF is white
     IO.writeCommandTransaction(0x13);
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042Z15_BUFFER_SIZE); // 0xFF is white
     IO.writeCommandTransaction(0x12); //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -330,23 +289,18 @@ void GxGDEW042Z15::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10); // black
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042Z15_BUFFER_SIZE); // 0xFF is white
     IO.writeCommandTransaction(0x13); // red
-    for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-    {
-      IO.writeDataTransaction(0xFF); // 0xFF is white
-    }
+    GxIO_Burst(IO).fill(0xFF, GxGDEW042Z15_BUFFER_SIZE); // 0xFF is white
     IO.writeCommandTransaction(0x12); //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW042Z15::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_rotation)
   {
@@ -373,7 +327,7 @@ void GxGDEW042Z15::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   IO.writeCommandTransaction(0x91); // partial in
   _writeToWindow(x, y, x, y, w, h);
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("updateWindow");
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
 }
 
@@ -394,24 +348,14 @@ void GxGDEW042Z15::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   IO.writeCommandTransaction(0x10); // black
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    writeBufferData(IO, _black_buffer, sizeof(_black_buffer), y1 * (GxGDEW042Z15_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
   }
   delay(2);
   //_setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x13); // red
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-      IO.writeDataTransaction(~data);
-    }
+    writeBufferData(IO, _red_buffer, sizeof(_red_buffer), y1 * (GxGDEW042Z15_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
   }
 #ifdef USE_PARTIAL_UPDATE_WORKAROUND
   _setPartialRamArea(0, 0, GxGDEW042Z15_WIDTH - 1, GxGDEW042Z15_HEIGHT - 1);
@@ -420,6 +364,7 @@ void GxGDEW042Z15::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
 
 void GxGDEW042Z15::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -451,7 +396,7 @@ void GxGDEW042Z15::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   IO.writeCommandTransaction(0x91); // partial in
   _writeToWindow(xs, ys, xd, yd, w, h);
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   delay(1000); // don't stress this display
 }
@@ -465,32 +410,39 @@ uint16_t GxGDEW042Z15::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 {
   x &= 0xFFF8; // byte boundary
   xe |= 0x0007; // byte boundary
-  IO.writeCommandTransaction(0x90); // partial window
-  IO.writeDataTransaction(x / 256);
-  IO.writeDataTransaction(x % 256);
-  IO.writeDataTransaction(xe / 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  //IO.writeDataTransaction(0x01); // distortion on full right half
-  IO.writeDataTransaction(0x00); // distortion on right half
+  {
+    const uint8_t data[] =
+    {
+      uint8_t(x / 256),
+      uint8_t(x % 256),
+      uint8_t(xe / 256),
+      uint8_t(xe % 256),
+      uint8_t(y / 256),
+      uint8_t(y % 256),
+      uint8_t(ye / 256),
+      uint8_t(ye % 256),
+      //0x01, // distortion on full right half
+      0x00 // distortion on right half
+    };
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   uint16_t xb = x / 8; // first byte (containing first bit)
   uint16_t xeb = xe / 8; // last byte (containing last bit)
   return xeb - xb + 1; // number of bytes to transfer
 }
 
-void GxGDEW042Z15::_waitWhileBusy(const char* comment)
+void GxGDEW042Z15::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   { //=0 BUSY
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > GxGDEW042Z15_BUSY_TIMEOUT)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -507,6 +459,7 @@ void GxGDEW042Z15::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void GxGDEW042Z15::_wakeUp(void)
@@ -516,28 +469,25 @@ void GxGDEW042Z15::_wakeUp(void)
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
+  }
+  {
+    const uint8_t data[] = {0x17, 0x17, 0x17};
+    IO.writeCommandData(0x06, data, sizeof(data)); //boost
   }
-  IO.writeCommandTransaction(0x06); //boost
-  IO.writeDataTransaction (0x17);
-  IO.writeDataTransaction (0x17);
-  IO.writeDataTransaction (0x17);
   IO.writeCommandTransaction(0x04);
-  _waitWhileBusy("Power On");
-  IO.writeCommandTransaction(0x00);
-  IO.writeDataTransaction(0x0f); // LUT from OTP Pixel with B/W/R.
+  _waitWhileBusy("Power On", wait_power_on);
+  IO.writeCommandData(0x00, 0x0f); // LUT from OTP Pixel with B/W/R.
 }
 
 void GxGDEW042Z15::_sleep(void)
 {
-  IO.writeCommandTransaction(0x50); // border floating
-  IO.writeDataTransaction(0x17);
+  IO.writeCommandData(0x50, 0x17); // border floating
   IO.writeCommandTransaction(0x02); // power off
-  _waitWhileBusy("Power Off");
+  _waitWhileBusy("Power Off", wait_power_off);
   if (_rst >= 0)
   {
-    IO.writeCommandTransaction(0x07); // deep sleep
-    IO.writeDataTransaction(0xA5);
+    IO.writeCommandData(0x07, 0xA5); // deep sleep
   }
 }
 
@@ -550,35 +500,19 @@ void GxGDEW042Z15::drawPaged(void (*drawCallback)(void))
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   IO.writeCommandTransaction(0x13); // red
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -591,35 +525,19 @@ void GxGDEW042Z15::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   IO.writeCommandTransaction(0x13); // red
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -632,35 +550,19 @@ void GxGDEW042Z15::drawPaged(void (*drawCallback)(const void*), const void* p)
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   IO.writeCommandTransaction(0x13); // red
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -673,35 +575,19 @@ void GxGDEW042Z15::drawPaged(void (*drawCallback)(const void*, const void*), con
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_black_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   IO.writeCommandTransaction(0x13); // red
   for (_current_page = 0; _current_page < GxGDEW042Z15_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW042Z15_PAGE_HEIGHT; y1++)
-    {
-      for (int16_t x1 = 0; x1 < GxGDEW042Z15_WIDTH / 8; x1++)
-      {
-        uint16_t idx = y1 * (GxGDEW042Z15_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00;
-        IO.writeDataTransaction(~data);
-      }
-    }
+    drawPage(drawCallback, p1, p2);
+    IO.writeDataTransactionAsync(_red_buffer, GxGDEW042Z15_PAGE_HEIGHT * (GxGDEW042Z15_WIDTH / 8), true);
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -744,13 +630,13 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   _current_page = -1;
 }
@@ -773,13 +659,13 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   _current_page = -1;
 }
@@ -802,13 +688,13 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   _current_page = -1;
 }
@@ -831,42 +717,43 @@ void GxGDEW042Z15::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEW042Z15_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds);
     }
   }
   IO.writeCommandTransaction(0x12); //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   _current_page = -1;
 }
 
 void GxGDEW042Z15::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10); // black
-  for (uint32_t y = 0; y < GxGDEW042Z15_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < GxGDEW042Z15_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < GxGDEW042Z15_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW042Z15_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW042Z15_WIDTH / 8 - 4) && (y > GxGDEW042Z15_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW042Z15_HEIGHT - 33)) data = 0x00;
-      IO.writeDataTransaction(data);
+      for (uint32_t x = 0; x < GxGDEW042Z15_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW042Z15_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW042Z15_WIDTH / 8 - 4) && (y > GxGDEW042Z15_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW042Z15_HEIGHT - 33)) data = 0x00;
+        burst.write(data);
+      }
     }
   }
   IO.writeCommandTransaction(0x13); // red
-  for (uint32_t i = 0; i < GxGDEW042Z15_BUFFER_SIZE; i++)
-  {
-    IO.writeDataTransaction(0xFF); // 0xFF is white
-  }
+  GxIO_Burst(IO).fill(0xFF, GxGDEW042Z15_BUFFER_SIZE); // 0xFF is white
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
 
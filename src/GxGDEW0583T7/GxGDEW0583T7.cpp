@@ -29,44 +29,7 @@ GxGDEW0583T7::GxGDEW0583T7(GxIO& io, int8_t rst, int8_t busy)
     _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
     _rst(rst), _busy(busy)
 {
-}
-
-void GxGDEW0583T7::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW0583T7_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW0583T7_WIDTH - x - 1;
-      y = GxGDEW0583T7_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW0583T7_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW0583T7_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW0583T7_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW0583T7_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW0583T7_WIDTH / 8;
-  }
-
-  if (!color)
-    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-  else
-    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  setBufferLayout(buffer_bw, _buffer, 0, sizeof(_buffer), GxGDEW0583T7_WIDTH / 8, GxGDEW0583T7_PAGE_HEIGHT, &_current_page);
 }
 
 void GxGDEW0583T7::init(uint32_t serial_diag_bitrate)
@@ -76,8 +39,9 @@ void GxGDEW0583T7::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -96,25 +60,32 @@ void GxGDEW0583T7::fillScreen(uint16_t color)
   {
     _buffer[x] = data;
   }
+  bufferFilled(color);
 }
 
 void GxGDEW0583T7::update(void)
 {
   if (_current_page != -1) return;
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+  IO.startTransaction();
   {
+    GxIO_Burst burst(IO, true);
+    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+    {
 #if defined(ESP8266)
-    // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
-    // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
-    // if ((i % 10000) == 0) yield(); // avoid watchdog reset
+      // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
+      // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
+      // if ((i % 10000) == 0) yield(); // avoid watchdog reset
 #endif
-    _send8pixel(i < sizeof(_buffer) ? _buffer[i] : 0x00);
+      _send8pixel(burst, i < sizeof(_buffer) ? _buffer[i] : 0x00);
+    }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("update");
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -126,6 +97,7 @@ void  GxGDEW0583T7::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEW0583T7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (mode & bm_partial_update)
   {
@@ -133,22 +105,27 @@ void GxGDEW0583T7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _wakeUp();
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW0583T7_WIDTH - 1, GxGDEW0583T7_HEIGHT - 1);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+    IO.startTransaction();
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        _send8pixel(burst, data);
       }
-      _send8pixel(data);
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -156,33 +133,39 @@ void GxGDEW0583T7::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+    IO.startTransaction();
     {
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+      {
 #if defined(ESP8266)
-      // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
-      // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
-      // if ((i % 10000) == 0) yield(); // avoid watchdog reset
+        // (10000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 200ms
+        // (31000 * 8bit * (8bits/bit + gap)/ 4MHz = ~ 600ms is safe
+        // if ((i % 10000) == 0) yield(); // avoid watchdog reset
 #endif
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
-      {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        _send8pixel(burst, data);
       }
-      _send8pixel(data);
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW0583T7::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -191,12 +174,17 @@ void GxGDEW0583T7::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW0583T7_WIDTH - 1, GxGDEW0583T7_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+    IO.startTransaction();
     {
-      _send8pixel(0x00);
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+      {
+        _send8pixel(burst, 0x00);
+      }
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -204,18 +192,24 @@ void GxGDEW0583T7::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+    IO.startTransaction();
     {
-      _send8pixel(0x00);
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW0583T7_BUFFER_SIZE; i++)
+      {
+        _send8pixel(burst, 0x00);
+      }
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW0583T7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (using_rotation)
   {
     switch (getRotation())
@@ -250,27 +244,33 @@ void GxGDEW0583T7::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x10);
-  for (int16_t y1 = y; y1 <= ye; y1++)
+  IO.startTransaction();
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
+    GxIO_Burst burst(IO, true);
+    for (int16_t y1 = y; y1 <= ye; y1++)
     {
-      uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-      _send8pixel((idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
+      for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
+      {
+        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
+        _send8pixel(burst, (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
+      }
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("updateWindow");
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
 }
 
 void GxGDEW0583T7::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
 }
 
@@ -315,14 +315,19 @@ void GxGDEW0583T7::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   uint16_t xss_d8 = xs / 8;
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x10);
-  for (int16_t y1 = ys; y1 <= yse; y1++)
+  IO.startTransaction();
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
+    GxIO_Burst burst(IO, true);
+    for (int16_t y1 = ys; y1 <= yse; y1++)
     {
-      uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-      _send8pixel((idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
+      for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
+      {
+        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
+        _send8pixel(burst, (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00);
+      }
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x92); // partial out
 }
 
@@ -336,30 +341,37 @@ uint16_t GxGDEW0583T7::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, u
 {
   x &= 0xFFF8; // byte boundary
   xe = (xe - 1) | 0x0007; // byte boundary - 1
-  IO.writeCommandTransaction(0x90); // partial window
-  IO.writeDataTransaction(x / 256);
-  IO.writeDataTransaction(x % 256);
-  IO.writeDataTransaction(xe / 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  //IO.writeDataTransaction(0x01); // don't see any difference
-  IO.writeDataTransaction(0x00); // don't see any difference
+  {
+    const uint8_t data[] =
+    {
+      uint8_t(x / 256),
+      uint8_t(x % 256),
+      uint8_t(xe / 256),
+      uint8_t(xe % 256),
+      uint8_t(y / 256),
+      uint8_t(y % 256),
+      uint8_t(ye / 256),
+      uint8_t(ye % 256),
+      //0x01, // don't see any difference
+      0x00 // don't see any difference
+    };
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   return (7 + xe - x) / 8; // number of bytes to transfer per line
 }
 
-void GxGDEW0583T7::_waitWhileBusy(const char* comment)
+void GxGDEW0583T7::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   { //=0 BUSY
     if (digitalRead(_busy) == 1) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 40000000)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -376,9 +388,10 @@ void GxGDEW0583T7::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
-void GxGDEW0583T7::_send8pixel(uint8_t data)
+void GxGDEW0583T7::_send8pixel(GxIO_Burst& burst, uint8_t data)
 {
   for (uint8_t j = 0; j < 8; j++)
   {
@@ -388,7 +401,7 @@ void GxGDEW0583T7::_send8pixel(uint8_t data)
     j++;
     t |= data & 0x80 ? 0x00 : 0x03;
     data <<= 1;
-    IO.writeDataTransaction(t);
+    burst.write(t); // within transaction of caller
   }
 }
 
@@ -399,55 +412,53 @@ void GxGDEW0583T7::_wakeUp()
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
+  }
+  {
+    const uint8_t data[] = {0x37, 0x00};
+    IO.writeCommandData(0x01, data, sizeof(data)); // POWER SETTING
+  }
+  {
+    const uint8_t data[] = {0xCF, 0x08};
+    IO.writeCommandData(0X00, data, sizeof(data)); // PANNEL SETTING
+  }
+  {
+    const uint8_t data[] = {0xc7, 0xcc, 0x28};
+    IO.writeCommandData(0x06, data, sizeof(data)); // boost
   }
-  IO.writeCommandTransaction(0x01); // POWER SETTING
-  IO.writeDataTransaction (0x37);
-  IO.writeDataTransaction (0x00);
-  IO.writeCommandTransaction(0X00); // PANNEL SETTING
-  IO.writeDataTransaction(0xCF);
-  IO.writeDataTransaction(0x08);
-  IO.writeCommandTransaction(0x06); // boost
-  IO.writeDataTransaction (0xc7);
-  IO.writeDataTransaction (0xcc);
-  IO.writeDataTransaction (0x28);
-  IO.writeCommandTransaction(0x30); // PLL setting
-  IO.writeDataTransaction (0x3a);   // PLL: 15s refresh
+  IO.writeCommandData(0x30, 0x3a); // PLL setting : PLL: 15s refresh
   //IO.writeDataTransaction (0x3c); // PLL: 30s refresh
-  IO.writeCommandTransaction(0X41); // TEMPERATURE SETTING
-  IO.writeDataTransaction(0x00);
-  IO.writeCommandTransaction(0X50); // VCOM AND DATA INTERVAL SETTING
-  IO.writeDataTransaction(0x77);
-  IO.writeCommandTransaction(0X60); // TCON SETTING
-  IO.writeDataTransaction(0x22);
-  IO.writeCommandTransaction(0x61); // 600*448
-  IO.writeDataTransaction (0x02);   // source 600
-  IO.writeDataTransaction (0x58);
-  IO.writeDataTransaction (0x01);   // gate 448
-  IO.writeDataTransaction (0xc0);
-  IO.writeCommandTransaction(0X82); // VCOM VOLTAGE SETTING
-  IO.writeDataTransaction(0x28);    // all temperature range
-  IO.writeCommandTransaction(0xe5); //FLASH MODE
-  IO.writeDataTransaction(0x03);
+  IO.writeCommandData(0X41, 0x00); // TEMPERATURE SETTING
+  IO.writeCommandData(0X50, 0x77); // VCOM AND DATA INTERVAL SETTING
+  IO.writeCommandData(0X60, 0x22); // TCON SETTING
+  {
+    const uint8_t data[] =
+    {
+      0x02, // source 600
+      0x58,
+      0x01, // gate 448
+      0xc0
+    };
+    IO.writeCommandData(0x61, data, sizeof(data)); // 600*448
+  }
+  IO.writeCommandData(0X82, 0x28); // VCOM VOLTAGE SETTING : all temperature range
+  IO.writeCommandData(0xe5, 0x03); // FLASH MODE
   IO.writeCommandTransaction(0x04); //POWER ON
-  _waitWhileBusy("Power On");
+  _waitWhileBusy("Power On", wait_power_on);
 }
 
 void GxGDEW0583T7::_sleep(void)
 {
   /**********************************flash sleep**********************************/
-  IO.writeCommandTransaction(0X65); //FLASH CONTROL
-  IO.writeDataTransaction(0x01);
+  IO.writeCommandData(0X65, 0x01); // FLASH CONTROL
   IO.writeCommandTransaction(0xB9);
-  IO.writeCommandTransaction(0X65); //FLASH CONTROL
-  IO.writeDataTransaction(0x00);
+  IO.writeCommandData(0X65, 0x00); // FLASH CONTROL
   /**********************************flash sleep**********************************/
   IO.writeCommandTransaction(0x02); // POWER OFF
-  _waitWhileBusy("Power Off");
+  _waitWhileBusy("Power Off", wait_power_off);
   if (_rst >= 0)
   {
-    IO.writeCommandTransaction(0x07); // DEEP SLEEP
-    IO.writeDataTransaction(0xa5);
+    IO.writeCommandData(0x07, 0xa5); // DEEP SLEEP
   }
 }
 
@@ -460,23 +471,28 @@ void GxGDEW0583T7::drawPaged(void (*drawCallback)(void))
   for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
+        for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
+          _send8pixel(burst, data);
+        }
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -489,23 +505,28 @@ void GxGDEW0583T7::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
   for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
+        for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
+          _send8pixel(burst, data);
+        }
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -518,23 +539,28 @@ void GxGDEW0583T7::drawPaged(void (*drawCallback)(const void*), const void* p)
   for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
+        for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
+          _send8pixel(burst, data);
+        }
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -547,23 +573,28 @@ void GxGDEW0583T7::drawPaged(void (*drawCallback)(const void*, const void*), con
   for (_current_page = 0; _current_page < GxGDEW0583T7_PAGES; _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p1, p2);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      for (int16_t y1 = 0; y1 < GxGDEW0583T7_PAGE_HEIGHT; y1++)
       {
-        uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
-        uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
-        _send8pixel(data);
+        for (int16_t x1 = 0; x1 < GxGDEW0583T7_WIDTH / 8; x1++)
+        {
+          uint16_t idx = y1 * (GxGDEW0583T7_WIDTH / 8) + x1;
+          uint8_t data = (idx < sizeof(_buffer)) ? _buffer[idx] : 0x00;
+          _send8pixel(burst, data);
+        }
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -605,14 +636,14 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
+      drawPage(drawCallback);
       uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
 }
 
@@ -633,14 +664,14 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
 }
 
@@ -661,14 +692,14 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
+      drawPage(drawCallback, p);
       uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
 }
 
@@ -689,35 +720,41 @@ void GxGDEW0583T7::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
+      drawPage(drawCallback, p1, p2);
       uint16_t ys = yds % GxGDEW0583T7_PAGE_HEIGHT;
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW0583T7_PU_DELAY); // don't stress this display
 }
 
 void GxGDEW0583T7::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (uint32_t y = 0; y < GxGDEW0583T7_HEIGHT; y++)
+  IO.startTransaction();
   {
-    for (uint32_t x = 0; x < GxGDEW0583T7_WIDTH / 8; x++)
+    GxIO_Burst burst(IO, true);
+    for (uint32_t y = 0; y < GxGDEW0583T7_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW0583T7_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW0583T7_WIDTH / 8 - 4) && (y > GxGDEW0583T7_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW0583T7_HEIGHT - 33)) data = 0x00;
-      _send8pixel(~data);
+      for (uint32_t x = 0; x < GxGDEW0583T7_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW0583T7_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW0583T7_WIDTH / 8 - 4) && (y > GxGDEW0583T7_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW0583T7_HEIGHT - 33)) data = 0x00;
+        _send8pixel(burst, ~data);
+      }
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
 
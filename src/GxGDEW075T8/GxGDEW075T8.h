@@ -37,7 +37,6 @@ class GxGDEW075T8 : public GxEPD
 #else
     GxGDEW075T8(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
@@ -77,8 +76,8 @@ class GxGDEW075T8 : public GxEPD
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
     void _sleep();
-    void _waitWhileBusy(const char* comment = 0);
-    void _send8pixel(uint8_t data);
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
+    void _send8pixel(GxIO_Burst& burst, uint8_t data);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
 #if defined(__AVR)
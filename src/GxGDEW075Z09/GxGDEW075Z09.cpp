@@ -24,58 +24,44 @@
 // Partial Update Delay, may have an influence on degradation
 #define GxGDEW075Z09_PU_DELAY 500
 
+#define GxGDEW075Z09_BUSY_TIMEOUT 40000000
+
 GxGDEW075Z09::GxGDEW075Z09(GxIO& io, int8_t rst, int8_t busy)
-  : GxEPD(GxGDEW075Z09_WIDTH, GxGDEW075Z09_HEIGHT), IO(io),
+  : GxEPD(GxGDEW075Z09_WIDTH, GxGDEW075Z09_HEIGHT), _black_buffer(0), _red_buffer(0), _buffer_bytes(0), IO(io),
     _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
-    _rst(rst), _busy(busy)
+    _rst(rst), _busy(busy), _async(false), _async_state(async_idle), _async_start(0)
 {
+#if !defined(GxGDEW075Z09_EXTERNAL_BUFFER)
+  _black_buffer = _class_black_buffer;
+  _red_buffer = _class_red_buffer;
+  _buffer_bytes = sizeof(_class_black_buffer);
+  setBufferLayout(buffer_3c, _black_buffer, _red_buffer, _buffer_bytes, GxGDEW075Z09_WIDTH / 8, GxGDEW075Z09_PAGE_HEIGHT, &_current_page);
+#endif
 }
 
-void GxGDEW075Z09::drawPixel(int16_t x, int16_t y, uint16_t color)
+GxGDEW075Z09::GxGDEW075Z09(GxIO& io, int8_t rst, int8_t busy, uint8_t* black_buffer, uint8_t* red_buffer, uint32_t size)
+  : GxGDEW075Z09(io, rst, busy)
 {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+  _setBuffers(black_buffer, red_buffer, size);
+}
 
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-    case 1:
-      swap(x, y);
-      x = GxGDEW075Z09_WIDTH - x - 1;
-      break;
-    case 2:
-      x = GxGDEW075Z09_WIDTH - x - 1;
-      y = GxGDEW075Z09_HEIGHT - y - 1;
-      break;
-    case 3:
-      swap(x, y);
-      y = GxGDEW075Z09_HEIGHT - y - 1;
-      break;
-  }
-  uint16_t i = x / 8 + y * GxGDEW075Z09_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer)) return;
-  }
-  else
-  {
-    y -= _current_page * GxGDEW075Z09_PAGE_HEIGHT;
-    if ((y < 0) || (y >= GxGDEW075Z09_PAGE_HEIGHT)) return;
-    i = x / 8 + y * GxGDEW075Z09_WIDTH / 8;
-  }
+void GxGDEW075Z09::init(uint32_t serial_diag_bitrate, uint8_t* black_buffer, uint8_t* red_buffer, uint32_t size)
+{
+  _setBuffers(black_buffer, red_buffer, size);
+  init(serial_diag_bitrate);
+}
 
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-  if (color == GxEPD_WHITE) return;
-  else if (color == GxEPD_BLACK) _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2)) _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8)));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+void GxGDEW075Z09::_setBuffers(uint8_t* black_buffer, uint8_t* red_buffer, uint32_t size)
+{
+  // whole rows, at most the screen
+  uint16_t rows = gx_int32_min(size / (GxGDEW075Z09_WIDTH / 8), GxGDEW075Z09_HEIGHT);
+  if (!black_buffer || !red_buffer || !rows) return;
+  _black_buffer = black_buffer;
+  _red_buffer = red_buffer;
+  _buffer_bytes = uint32_t(rows) * (GxGDEW075Z09_WIDTH / 8);
+  setBufferLayout(buffer_3c, _black_buffer, _red_buffer, _buffer_bytes, GxGDEW075Z09_WIDTH / 8, rows, &_current_page);
+  clearDirty();
+  invalidateShadow();
 }
 
 void GxGDEW075Z09::init(uint32_t serial_diag_bitrate)
@@ -85,8 +71,9 @@ void GxGDEW075Z09::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, LOW);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -107,26 +94,33 @@ void GxGDEW075Z09::fillScreen(uint16_t color)
   else if (color == GxEPD_RED) red = 0xFF;
   else if ((color & 0xF100) > (0xF100 / 2))  red = 0xFF;
   else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2) black = 0xFF;
-  for (uint16_t x = 0; x < sizeof(_black_buffer); x++)
-  {
-    _black_buffer[x] = black;
-    _red_buffer[x] = red;
-  }
+  fillBuffers(black, red);
+  bufferFilled(color);
 }
 
 void GxGDEW075Z09::update(void)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
+  bufferUpdated();
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+  IO.startTransaction();
   {
-    uint32_t idx = i % sizeof(_black_buffer);
-    _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+    GxIO_Burst burst(IO, true);
+    uint32_t idx = 0;
+    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+    {
+      _send8pixel(burst, _black_buffer[idx], _red_buffer[idx]);
+      if (++idx == _buffer_bytes) idx = 0; // repeats a page buffer
+    }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("update");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("update", wait_full_refresh);
   _sleep();
 }
 
@@ -138,11 +132,14 @@ void  GxGDEW075Z09::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, ui
 
 void GxGDEW075Z09::drawExamplePicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size)
 {
+  invalidateShadow();
   drawPicture(black_bitmap, red_bitmap, black_size, red_size, bm_normal);
 }
 
 void GxGDEW075Z09::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
+  invalidateShadow();
+  finish();
   if (_current_page != -1) return;
   if (mode & bm_partial_update)
   {
@@ -150,21 +147,26 @@ void GxGDEW075Z09::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     _wakeUp();
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075Z09_WIDTH - 1, GxGDEW075Z09_HEIGHT - 1);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+    IO.startTransaction();
     {
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+      {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      uint8_t black_data = (i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00;
-      uint8_t red_data = (i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00;
+        uint8_t black_data = (i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00;
+        uint8_t red_data = (i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00;
 #else
-      uint8_t black_data = (i < black_size) ? black_bitmap[i] : 0x00;
-      uint8_t red_data = (i < red_size) ? red_bitmap[i] : 0x00;
+        uint8_t black_data = (i < black_size) ? black_bitmap[i] : 0x00;
+        uint8_t red_data = (i < red_size) ? red_bitmap[i] : 0x00;
 #endif
-      if (mode & bm_invert) black_data = ~black_data;
-      if (mode & bm_invert_red) red_data = ~red_data;
-      _send8pixel(black_data, red_data);
+        if (mode & bm_invert) black_data = ~black_data;
+        if (mode & bm_invert_red) red_data = ~red_data;
+        _send8pixel(burst, black_data, red_data);
+      }
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -172,27 +174,33 @@ void GxGDEW075Z09::drawPicture(const uint8_t* black_bitmap, const uint8_t* red_b
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+    IO.startTransaction();
     {
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+      {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-      uint8_t black_data = (i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00;
-      uint8_t red_data = (i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00;
+        uint8_t black_data = (i < black_size) ? pgm_read_byte(&black_bitmap[i]) : 0x00;
+        uint8_t red_data = (i < red_size) ? pgm_read_byte(&red_bitmap[i]) : 0x00;
 #else
-      uint8_t black_data = (i < black_size) ? black_bitmap[i] : 0x00;
-      uint8_t red_data = (i < red_size) ? red_bitmap[i] : 0x00;
+        uint8_t black_data = (i < black_size) ? black_bitmap[i] : 0x00;
+        uint8_t red_data = (i < red_size) ? red_bitmap[i] : 0x00;
 #endif
-      if (mode & bm_invert) black_data = ~black_data;
-      if (mode & bm_invert_red) red_data = ~red_data;
-      _send8pixel(black_data, red_data);
+        if (mode & bm_invert) black_data = ~black_data;
+        if (mode & bm_invert_red) red_data = ~red_data;
+        _send8pixel(burst, black_data, red_data);
+      }
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW075Z09::drawExamplePicture_3C(const uint8_t* bitmap_3C, uint32_t size_3C, int16_t mode)
 {
+  finish();
   unsigned long int i;
   unsigned char j, temp1, temp2, temp3;
   if (mode & bm_partial_update)
@@ -207,38 +215,43 @@ void GxGDEW075Z09::drawExamplePicture_3C(const uint8_t* bitmap_3C, uint32_t size
     _wakeUp();
   }
   IO.writeCommandTransaction(0x10);
-  for (i = 0; i < 2 * GxGDEW075Z09_BYTE_SIZE; i++)
   {
+    GxIO_Burst burst(IO);
+    for (i = 0; i < 2 * GxGDEW075Z09_BYTE_SIZE; i++)
+    {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-    temp1 = (i < size_3C) ? pgm_read_byte(&bitmap_3C[i]) : 0x00;
+      temp1 = (i < size_3C) ? pgm_read_byte(&bitmap_3C[i]) : 0x00;
 #else
-    temp1 = (i < size_3C) ? bitmap_3C[i] : 0x00;
+      temp1 = (i < size_3C) ? bitmap_3C[i] : 0x00;
 #endif
-    for (j = 0; j < 4; j++)
-    {
-      temp2 = temp1 & 0xc0 ;
-      if (temp2 == 0xc0) temp3 = 0x00;
-      else if (temp2 == 0x00) temp3 = 0x03;
-      else temp3 = 0x04;
-      temp1 <<= 2;
-      temp3 <<= 4;
-      j++;
-      temp2 = temp1 & 0xc0 ;
-      if (temp2 == 0xc0) temp3 |= 0x00;
-      else if (temp2 == 0x00) temp3 |= 0x03;
-      else temp3 |= 0x04;
-      temp1 <<= 2;
-      IO.writeDataTransaction(temp3);
+      for (j = 0; j < 4; j++)
+      {
+        temp2 = temp1 & 0xc0 ;
+        if (temp2 == 0xc0) temp3 = 0x00;
+        else if (temp2 == 0x00) temp3 = 0x03;
+        else temp3 = 0x04;
+        temp1 <<= 2;
+        temp3 <<= 4;
+        j++;
+        temp2 = temp1 & 0xc0 ;
+        if (temp2 == 0xc0) temp3 |= 0x00;
+        else if (temp2 == 0x00) temp3 |= 0x03;
+        else temp3 |= 0x04;
+        temp1 <<= 2;
+        burst.write(temp3);
+      }
     }
   }
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawExamplePicture_3C");
+  _waitWhileBusy("drawExamplePicture_3C", wait_refresh);
   if (_using_partial_mode) IO.writeCommandTransaction(0x92); // partial out  
   else _sleep();
 }
 
 void GxGDEW075Z09::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
+  finish();
   if (_current_page != -1) return;
   if (mode & bm_partial_update)
   {
@@ -247,22 +260,27 @@ void GxGDEW075Z09::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075Z09_WIDTH - 1, GxGDEW075Z09_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+    IO.startTransaction();
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        _send8pixel(burst, data, 0x00);
       }
-      _send8pixel(data, 0x00);
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -270,28 +288,35 @@ void GxGDEW075Z09::drawBitmap(const uint8_t* bitmap, uint32_t size, int16_t mode
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+    IO.startTransaction();
     {
-      uint8_t data = 0x00; // white is 0x00 on device
-      if (i < size)
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
       {
+        uint8_t data = 0x00; // white is 0x00 on device
+        if (i < size)
+        {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[i]);
+          data = pgm_read_byte(&bitmap[i]);
 #else
-        data = bitmap[i];
+          data = bitmap[i];
 #endif
-        if (mode & bm_invert) data = ~data;
+          if (mode & bm_invert) data = ~data;
+        }
+        _send8pixel(burst, data, 0x00);
       }
-      _send8pixel(data, 0x00);
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("drawBitmap");
+    _waitWhileBusy("drawBitmap", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW075Z09::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
+  finish();
   if (_current_page != -1) return;
   if (using_partial_update)
   {
@@ -300,12 +325,17 @@ void GxGDEW075Z09::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, GxGDEW075Z09_WIDTH - 1, GxGDEW075Z09_HEIGHT - 1);
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+    IO.startTransaction();
     {
-      _send8pixel(0x00, 0x00);
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+      {
+        _send8pixel(burst, 0x00, 0x00);
+      }
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -313,18 +343,26 @@ void GxGDEW075Z09::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     IO.writeCommandTransaction(0x10);
-    for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+    IO.startTransaction();
     {
-      _send8pixel(0x00, 0x00);
+      GxIO_Burst burst(IO, true);
+      for (uint32_t i = 0; i < GxGDEW075Z09_BYTE_SIZE; i++)
+      {
+        _send8pixel(burst, 0x00, 0x00);
+      }
     }
+    IO.endTransaction();
     IO.writeCommandTransaction(0x12);      //display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void GxGDEW075Z09::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
+  finish();
+  if (!_black_buffer) return; // no buffers bound
   if (using_rotation)
   {
     switch (getRotation())
@@ -358,27 +396,88 @@ void GxGDEW075Z09::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   IO.writeCommandTransaction(0x91); // partial in
   _setPartialRamArea(x, y, xe, ye);
   IO.writeCommandTransaction(0x10);
-  for (int16_t y1 = y; y1 <= ye; y1++)
+  IO.startTransaction();
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
+    GxIO_Burst burst(IO, true);
+    for (int16_t y1 = y; y1 <= ye; y1++)
     {
-      uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-      _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+      // whole rows in the buffer, a page buffer repeats
+      uint32_t row = (uint32_t(y1) * (GxGDEW075Z09_WIDTH / 8)) % _buffer_bytes;
+      for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
+      {
+        _send8pixel(burst, _black_buffer[row + x1], _red_buffer[row + x1]);
+      }
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("updateWindow");
+  if (_startAsync(async_partial_refresh, wait_partial_refresh)) return;
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
 }
 
+void GxGDEW075Z09::updateAsync()
+{
+  _async = true;
+  update();
+  _async = false;
+}
+
+void GxGDEW075Z09::updateWindowAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
+{
+  _async = true;
+  updateWindow(x, y, w, h, using_rotation);
+  _async = false;
+}
+
+bool GxGDEW075Z09::isBusy()
+{
+  switch (_async_state)
+  {
+    case async_refresh:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW075Z09_BUSY_TIMEOUT)) return true;
+      if (deferPowerOff()) break;
+      _powerOff();
+      startBusyPoll(wait_power_off);
+      _async_state = async_power_off;
+      return true;
+    case async_power_off:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW075Z09_BUSY_TIMEOUT)) return true;
+      _deepSleep();
+      break;
+    case async_partial_refresh:
+      if (pollBusy(digitalRead(_busy) == 0, GxGDEW075Z09_BUSY_TIMEOUT)) return true;
+      IO.writeCommandTransaction(0x92); // partial out
+      _async_start = millis();
+      _async_state = async_partial_delay;
+      return true;
+    case async_partial_delay:
+      if (millis() - _async_start < GxGDEW075Z09_PU_DELAY) return true; // don't stress this display
+      break;
+  }
+  _async_state = async_idle;
+  return false;
+}
+
+bool GxGDEW075Z09::_startAsync(uint8_t state, busy_wait wait)
+{
+  if (!_async) return false;
+  startBusyPoll(wait);
+  _async_state = state;
+  return true;
+}
+
 void GxGDEW075Z09::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
+  finish();
+  if (!_black_buffer) return; // no buffers bound
   if (!_using_partial_mode) _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
 }
 
@@ -423,51 +522,68 @@ void GxGDEW075Z09::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_
   uint16_t xss_d8 = xs / 8;
   uint16_t xse_d8 = xss_d8 + _setPartialRamArea(xd, yd, xde, yde);
   IO.writeCommandTransaction(0x10);
-  for (int16_t y1 = ys; y1 <= yse; y1++)
+  IO.startTransaction();
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
+    GxIO_Burst burst(IO, true);
+    const uint8_t* black = bufferBlack();
+    const uint8_t* red = bufferRed();
+    uint32_t size = bufferSize();
+    for (int16_t y1 = ys; y1 <= yse; y1++)
     {
-      uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-      _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+      for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
+      {
+        uint32_t idx = uint32_t(y1) * (GxGDEW075Z09_WIDTH / 8) + x1;
+        if (idx < size) _send8pixel(burst, black[idx], red[idx]);
+        else _send8pixel(burst, 0x00, 0x00);
+      }
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x92); // partial out
 }
 
 void GxGDEW075Z09::powerDown()
 {
+  finish();
   _using_partial_mode = false; // force _wakeUp()
-  _sleep();
+  _sleep(false);
 }
 
 uint16_t GxGDEW075Z09::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye)
 {
   x &= 0xFFF8; // byte boundary
   xe = (xe - 1) | 0x0007; // byte boundary - 1
-  IO.writeCommandTransaction(0x90); // partial window
-  IO.writeDataTransaction(x / 256);
-  IO.writeDataTransaction(x % 256);
-  IO.writeDataTransaction(xe / 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  IO.writeDataTransaction(0x01); // don't see any difference
+  {
+    const uint8_t data[] =
+    {
+      uint8_t(x / 256),
+      uint8_t(x % 256),
+      uint8_t(xe / 256),
+      uint8_t(xe % 256),
+      uint8_t(y / 256),
+      uint8_t(y % 256),
+      uint8_t(ye / 256),
+      uint8_t(ye % 256),
+      0x01 // don't see any difference
+    };
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   //IO.writeDataTransaction(0x00); // don't see any difference
   return (7 + xe - x) / 8; // number of bytes to transfer per line
 }
 
-void GxGDEW075Z09::_waitWhileBusy(const char* comment)
+void GxGDEW075Z09::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   { //=0 BUSY
     if (digitalRead(_busy) == 1) break;
-    delay(1);
-    if (micros() - start > 40000000)
+    busyIdle();
+    if (micros() - start > GxGDEW075Z09_BUSY_TIMEOUT)
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -484,9 +600,10 @@ void GxGDEW075Z09::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
-void GxGDEW075Z09::_send8pixel(uint8_t black_data, uint8_t red_data)
+void GxGDEW075Z09::_send8pixel(GxIO_Burst& burst, uint8_t black_data, uint8_t red_data)
 {
   for (uint8_t j = 0; j < 8; j++)
   {
@@ -503,201 +620,245 @@ void GxGDEW075Z09::_send8pixel(uint8_t black_data, uint8_t red_data)
     else t |= 0x03; // white
     black_data <<= 1;
     red_data <<= 1;
-    IO.writeDataTransaction(t);
+    burst.write(t); // within transaction of caller
   }
 }
 
 void GxGDEW075Z09::_wakeUp()
 {
+  if (isKeptPowered()) return;
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, LOW, 10); // 10ms if no BUSY
   }
 
   /**********************************release flash sleep**********************************/
-  IO.writeCommandTransaction(0X65);     //FLASH CONTROL
-  IO.writeDataTransaction(0x01);
+  IO.writeCommandData(0X65, 0x01); // FLASH CONTROL
 
   IO.writeCommandTransaction(0xAB);
 
-  IO.writeCommandTransaction(0X65);     //FLASH CONTROL
-  IO.writeDataTransaction(0x00);
+  IO.writeCommandData(0X65, 0x00); // FLASH CONTROL
   /**********************************release flash sleep**********************************/
-  IO.writeCommandTransaction(0x01);
-  IO.writeDataTransaction (0x37);       //POWER SETTING
-  IO.writeDataTransaction (0x00);
+  {
+    const uint8_t data[] =
+    {
+      0x37, //POWER SETTING
+      0x00
+    };
+    IO.writeCommandData(0x01, data, sizeof(data));
+  }
 
-  IO.writeCommandTransaction(0X00);     //PANNEL SETTING
-  IO.writeDataTransaction(0xCF);
-  IO.writeDataTransaction(0x08);
+  {
+    const uint8_t data[] = {0xCF, 0x08};
+    IO.writeCommandData(0X00, data, sizeof(data)); //PANNEL SETTING
+  }
 
-  IO.writeCommandTransaction(0x06);     //boost
-  IO.writeDataTransaction (0xc7);
-  IO.writeDataTransaction (0xcc);
-  IO.writeDataTransaction (0x28);
+  {
+    const uint8_t data[] = {0xc7, 0xcc, 0x28};
+    IO.writeCommandData(0x06, data, sizeof(data)); //boost
+  }
 
-  IO.writeCommandTransaction(0x30);     //PLL setting
-  IO.writeDataTransaction (0x3c);
+  IO.writeCommandData(0x30, 0x3c); // PLL setting
 
-  IO.writeCommandTransaction(0X41);     //TEMPERATURE SETTING
-  IO.writeDataTransaction(0x00);
+  IO.writeCommandData(0X41, 0x00); // TEMPERATURE SETTING
 
-  IO.writeCommandTransaction(0X50);     //VCOM AND DATA INTERVAL SETTING
-  IO.writeDataTransaction(0x77);
+  IO.writeCommandData(0X50, 0x77); // VCOM AND DATA INTERVAL SETTING
 
-  IO.writeCommandTransaction(0X60);     //TCON SETTING
-  IO.writeDataTransaction(0x22);
+  IO.writeCommandData(0X60, 0x22); // TCON SETTING
 
-  IO.writeCommandTransaction(0x61);     //tres 640*384
-  IO.writeDataTransaction (0x02);       //source 640
-  IO.writeDataTransaction (0x80);
-  IO.writeDataTransaction (0x01);       //gate 384
-  IO.writeDataTransaction (0x80);
+  {
+    const uint8_t data[] =
+    {
+      0x02, //source 640
+      0x80,
+      0x01, //gate 384
+      0x80
+    };
+    IO.writeCommandData(0x61, data, sizeof(data)); //tres 640*384
+  }
 
-  IO.writeCommandTransaction(0X82);     //VDCS SETTING
-  IO.writeDataTransaction(0x1E);        //decide by LUT file
+  IO.writeCommandData(0X82, 0x1E); // VDCS SETTING : decide by LUT file
 
-  IO.writeCommandTransaction(0xe5);     //FLASH MODE
-  IO.writeDataTransaction(0x03);
+  IO.writeCommandData(0xe5, 0x03); // FLASH MODE
 
   IO.writeCommandTransaction(0x04);     //POWER ON
   _waitWhileBusy();
 }
 
-void GxGDEW075Z09::_sleep(void)
+void GxGDEW075Z09::_sleep(bool deferrable)
+{
+  if (deferrable && deferPowerOff()) return; // kept powered, see GxEPD::setPowerPolicy()
+  _powerOff();
+  _waitWhileBusy();
+  _deepSleep();
+}
+
+void GxGDEW075Z09::_powerOff(void)
 {
   /**********************************flash sleep**********************************/
-  IO.writeCommandTransaction(0X65);     //FLASH CONTROL
-  IO.writeDataTransaction(0x01);
+  IO.writeCommandData(0X65, 0x01); // FLASH CONTROL
 
   IO.writeCommandTransaction(0xB9);
 
-  IO.writeCommandTransaction(0X65);     //FLASH CONTROL
-  IO.writeDataTransaction(0x00);
+  IO.writeCommandData(0X65, 0x00); // FLASH CONTROL
   /**********************************flash sleep**********************************/
 
   IO.writeCommandTransaction(0x02);     // POWER OFF
-  _waitWhileBusy();
+}
 
+void GxGDEW075Z09::_deepSleep(void)
+{
+  onPowerOff();
   if (_rst >= 0)
   {
-    IO.writeCommandTransaction(0x07);     // DEEP SLEEP
-    IO.writeDataTransaction(0xa5);
+    IO.writeCommandData(0x07, 0xa5); // DEEP SLEEP
   }
 }
 
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(void))
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback();
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      const uint8_t* black = bufferBlack();
+      const uint8_t* red = bufferRed();
+      for (uint32_t i = uint32_t(pageRows(_current_page)) * (GxGDEW075Z09_WIDTH / 8); i > 0; i--)
       {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+        _send8pixel(burst, *black++, *red++);
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(uint32_t), uint32_t p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      const uint8_t* black = bufferBlack();
+      const uint8_t* red = bufferRed();
+      for (uint32_t i = uint32_t(pageRows(_current_page)) * (GxGDEW075Z09_WIDTH / 8); i > 0; i--)
       {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+        _send8pixel(burst, *black++, *red++);
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(const void*), const void* p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p);
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      const uint8_t* black = bufferBlack();
+      const uint8_t* red = bufferRed();
+      for (uint32_t i = uint32_t(pageRows(_current_page)) * (GxGDEW075Z09_WIDTH / 8); i > 0; i--)
       {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+        _send8pixel(burst, *black++, *red++);
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
 void GxGDEW075Z09::drawPaged(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _using_partial_mode = false;
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
     fillScreen(GxEPD_WHITE);
-    drawCallback(p1, p2);
-    for (int16_t y1 = 0; y1 < GxGDEW075Z09_PAGE_HEIGHT; y1++)
+    drawPage(drawCallback, p1, p2);
+    IO.startTransaction();
     {
-      for (int16_t x1 = 0; x1 < GxGDEW075Z09_WIDTH / 8; x1++)
+      GxIO_Burst burst(IO, true);
+      const uint8_t* black = bufferBlack();
+      const uint8_t* red = bufferRed();
+      for (uint32_t i = uint32_t(pageRows(_current_page)) * (GxGDEW075Z09_WIDTH / 8); i > 0; i--)
       {
-        uint16_t idx = (y1 * (GxGDEW075Z09_WIDTH / 8) + x1) % sizeof(_black_buffer);
-        _send8pixel(_black_buffer[idx], _red_buffer[idx]);
+        _send8pixel(burst, *black++, *red++);
       }
     }
+    IO.endTransaction();
 #if defined(ESP8266)
     yield();
 #endif
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPaged");
+  if (_startAsync(async_refresh, wait_full_refresh)) return;
+  _waitWhileBusy("drawPaged", wait_full_refresh);
   _sleep();
 }
 
@@ -724,7 +885,9 @@ void GxGDEW075Z09::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
 
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -732,27 +895,31 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uin
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback();
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      drawPage(drawCallback);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
 }
 
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -760,27 +927,31 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x,
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      drawPage(drawCallback, p);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
 }
 
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -788,27 +959,31 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*), uint16_t
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p);
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      drawPage(drawCallback, p);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
 }
 
 void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*, const void*), uint16_t x, uint16_t y, uint16_t w, uint16_t h, const void* p1, const void* p2)
 {
+  finish();
   if (_current_page != -1) return;
+  if (!_black_buffer) return; // no buffers bound
   _rotate(x, y, w, h);
   if (!_using_partial_mode)
   {
@@ -816,42 +991,51 @@ void GxGDEW075Z09::drawPagedToWindow(void (*drawCallback)(const void*, const voi
     eraseDisplay(true);
   }
   _using_partial_mode = true;
-  for (_current_page = 0; _current_page < GxGDEW075Z09_PAGES; _current_page++)
+  beginPages();
+  for (_current_page = 0; _current_page < pageCount(); _current_page++)
   {
-    uint16_t yds = gx_uint16_max(y, _current_page * GxGDEW075Z09_PAGE_HEIGHT);
-    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * GxGDEW075Z09_PAGE_HEIGHT);
+    uint16_t yds = gx_uint16_max(y, _current_page * pageHeight());
+    uint16_t yde = gx_uint16_min(y + h, (_current_page + 1) * pageHeight());
     if (yde > yds)
     {
       fillScreen(GxEPD_WHITE);
-      drawCallback(p1, p2);
-      uint16_t ys = yds % GxGDEW075Z09_PAGE_HEIGHT;
+      drawPage(drawCallback, p1, p2);
+      uint16_t ys = yds - _current_page * pageHeight();
       _writeToWindow(x, ys, x, yds, w, yde - yds, false);
     }
   }
   _current_page = -1;
+  endPages();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawPagedToWindow");
+  _waitWhileBusy("drawPagedToWindow", wait_partial_refresh);
   delay(GxGDEW075Z09_PU_DELAY); // don't stress this display
 }
 
 void GxGDEW075Z09::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
+  finish();
   _wakeUp();
   IO.writeCommandTransaction(0x10);
-  for (uint32_t y = 0; y < GxGDEW075Z09_HEIGHT; y++)
+  IO.startTransaction();
   {
-    for (uint32_t x = 0; x < GxGDEW075Z09_WIDTH / 8; x++)
+    GxIO_Burst burst(IO, true);
+    for (uint32_t y = 0; y < GxGDEW075Z09_HEIGHT; y++)
     {
-      uint8_t data = 0xFF;
-      if ((x < 1) && (y < 8)) data = 0x00;
-      if ((x > GxGDEW075Z09_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
-      if ((x > GxGDEW075Z09_WIDTH / 8 - 4) && (y > GxGDEW075Z09_HEIGHT - 25)) data = 0x00;
-      if ((x < 4) && (y > GxGDEW075Z09_HEIGHT - 33)) data = 0x00;
-      _send8pixel(~data, 0x00);
+      for (uint32_t x = 0; x < GxGDEW075Z09_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF;
+        if ((x < 1) && (y < 8)) data = 0x00;
+        if ((x > GxGDEW075Z09_WIDTH / 8 - 3) && (y < 16)) data = 0x00;
+        if ((x > GxGDEW075Z09_WIDTH / 8 - 4) && (y > GxGDEW075Z09_HEIGHT - 25)) data = 0x00;
+        if ((x < 4) && (y > GxGDEW075Z09_HEIGHT - 33)) data = 0x00;
+        _send8pixel(burst, ~data, 0x00);
+      }
     }
   }
+  IO.endTransaction();
   IO.writeCommandTransaction(0x12);      //display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
 
@@ -39,6 +39,10 @@
 #define GxGDEW075Z09_PAGE_SIZE (GxGDEW075Z09_BYTE_SIZE / GxGDEW075Z09_PAGES)
 #define GxGDEW075Z09_BUFFER_SIZE GxGDEW075Z09_PAGE_SIZE
 
+// uncomment to leave the buffers out of the class, buffers of caller memory must then be bound at construction or init(),
+// updates and drawPaged() do nothing while no buffers are bound
+//#define GxGDEW075Z09_EXTERNAL_BUFFER
+
 class GxGDEW075Z09 : public GxEPD
 {
   public:
@@ -47,8 +51,11 @@ class GxGDEW075Z09 : public GxEPD
 #else
     GxGDEW075Z09(GxIO& io, int8_t rst = 9, int8_t busy = 7);
 #endif
-    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    // with buffers of caller memory, e.g. in PSRAM or a static arena, of size bytes each, replace the buffers of the class :
+    // GxGDEW075Z09_BYTE_SIZE for full screen, else pages of size / (GxGDEW075Z09_WIDTH / 8) rows for drawPaged()
+    GxGDEW075Z09(GxIO& io, int8_t rst, int8_t busy, uint8_t* black_buffer, uint8_t* red_buffer, uint32_t size);
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
+    void init(uint32_t serial_diag_bitrate, uint8_t* black_buffer, uint8_t* red_buffer, uint32_t size); // binds the buffers, e.g. allocated in setup()
     void fillScreen(uint16_t color); // 0x0 black, >0x0 white, to buffer
     void update(void);
     // to buffer, may be cropped, drawPixel() used, update needed
@@ -69,12 +76,27 @@ class GxGDEW075Z09 : public GxEPD
     void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     // terminate cleanly updateWindow or updateToWindow before removing power or long delays
     void powerDown();
-    // paged drawing, for limited RAM, drawCallback() is called GxGDEW075Z09_PAGES times
+    // non-blocking update, refresh and power off are completed by isBusy() or finish()
+    void updateAsync();
+    // non-blocking partial update, refresh and partial update delay are completed by isBusy() or finish()
+    void updateWindowAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true);
+    bool isBusy();
+    // paged drawing, for limited RAM, drawCallback() is called GxGDEW075Z09_PAGES times, or once per page of setPageBuffer()
     // each call of drawCallback() should draw the same
     void drawPaged(void (*drawCallback)(void));
     void drawPaged(void (*drawCallback)(uint32_t), uint32_t);
     void drawPaged(void (*drawCallback)(const void*), const void*);
     void drawPaged(void (*drawCallback)(const void*, const void*), const void*, const void*);
+    // non-blocking paged drawing, refresh and power off are completed by isBusy() or finish()
+    void drawPagedAsync(void (*drawCallback)(void)) {_async = true; drawPaged(drawCallback); _async = false;};
+    void drawPagedAsync(void (*drawCallback)(uint32_t), uint32_t p) {_async = true; drawPaged(drawCallback, p); _async = false;};
+    void drawPagedAsync(void (*drawCallback)(const void*), const void* p) {_async = true; drawPaged(drawCallback, p); _async = false;};
+    void drawPagedAsync(void (*drawCallback)(const void*, const void*), const void* p1, const void* p2)
+    {
+      _async = true;
+      drawPaged(drawCallback, p1, p2);
+      _async = false;
+    };
     // paged drawing to screen rectangle at (x,y) using partial update
     void drawPagedToWindow(void (*drawCallback)(void), uint16_t x, uint16_t y, uint16_t w, uint16_t h);
     void drawPagedToWindow(void (*drawCallback)(uint32_t), uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t);
@@ -92,19 +114,33 @@ class GxGDEW075Z09 : public GxEPD
     void _writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
     uint16_t _setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, uint16_t ye);
     void _wakeUp();
-    void _sleep();
-    void _waitWhileBusy(const char* comment = 0);
-    void _send8pixel(uint8_t black_data, uint8_t red_data);
+    void _sleep(bool deferrable = true); // deferrable by the power policy
+    void _powerOff();
+    void _deepSleep();
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
+    bool _startAsync(uint8_t state, busy_wait wait);
+    void _send8pixel(GxIO_Burst& burst, uint8_t black_data, uint8_t red_data);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
+    void _setBuffers(uint8_t* black_buffer, uint8_t* red_buffer, uint32_t size);
   private:
-    uint8_t _black_buffer[GxGDEW075Z09_BUFFER_SIZE];
-    uint8_t _red_buffer[GxGDEW075Z09_BUFFER_SIZE];
+#if !defined(GxGDEW075Z09_EXTERNAL_BUFFER)
+    uint8_t _class_black_buffer[GxGDEW075Z09_BUFFER_SIZE];
+    uint8_t _class_red_buffer[GxGDEW075Z09_BUFFER_SIZE];
+#endif
+    uint8_t* _black_buffer; // the buffers of the class or of caller memory, 0 if none bound
+    uint8_t* _red_buffer;
+    uint32_t _buffer_bytes; // of each buffer
     GxIO& IO;
     int16_t _current_page;
     bool _using_partial_mode;
     bool _diag_enabled;
     int8_t _rst;
     int8_t _busy;
+    // refresh state machine of non-blocking operations
+    enum {async_idle, async_refresh, async_power_off, async_partial_refresh, async_partial_delay};
+    bool _async; // next refresh non-blocking
+    uint8_t _async_state;
+    uint32_t _async_start;
 #if defined(ESP8266) || defined(ESP32)
   public:
     // the compiler of these packages has a problem with signature matching to base classes
@@ -4,6 +4,124 @@
 
 #include "GxIO.h"
 
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+#if defined(GxEPD_STATISTICS)
+void GxIO::resetStatistics()
+{
+  memset(&_statistics, 0, sizeof(_statistics));
+  _transaction_start = 0;
+}
+
+uint32_t GxIO::getCommandCount(uint8_t c) const
+{
+  for (uint8_t i = 0; i < _statistics.commands_listed; i++)
+  {
+    if (_statistics.command_counts[i].command == c) return _statistics.command_counts[i].count;
+  }
+  return 0;
+}
+
+void GxIO::_countCommand(uint8_t c)
+{
+  _statistics.command_bytes++;
+  for (uint8_t i = 0; i < _statistics.commands_listed; i++)
+  {
+    if (_statistics.command_counts[i].command == c)
+    {
+      _statistics.command_counts[i].count++;
+      return;
+    }
+  }
+  if (_statistics.commands_listed < GxIO_STATISTICS_COMMANDS)
+  {
+    _statistics.command_counts[_statistics.commands_listed].command = c;
+    _statistics.command_counts[_statistics.commands_listed].count = 1;
+    _statistics.commands_listed++;
+  }
+  else _statistics.commands_not_listed++;
+}
+#endif
+
+// defaults, io classes override what they support; defined to have the vtable of GxIO emitted
+
+void GxIO::reset()
+{
+}
+
+void GxIO::init()
+{
+}
+
+void GxIO::writeCommandTransaction(uint8_t c)
+{
+  startTransaction();
+  writeCommand(c);
+  endTransaction();
+}
+
+void GxIO::writeDataTransaction(uint8_t d)
+{
+  startTransaction();
+  writeData(d);
+  endTransaction();
+}
+
+void GxIO::writeData16Transaction(uint16_t d, uint32_t num)
+{
+  startTransaction();
+  writeData16(d, num);
+  endTransaction();
+}
+
+void GxIO::writeCommand(uint8_t c)
+{
+}
+
+void GxIO::writeData(uint8_t d)
+{
+}
+
+void GxIO::writeData(uint8_t* d, uint32_t num)
+{
+  while (num > 0)
+  {
+    writeData(*d++);
+    num--;
+  }
+}
+
+void GxIO::writeData16(uint16_t d, uint32_t num)
+{
+  while (num > 0)
+  {
+    writeData(d >> 8);
+    writeData(d & 0xFF);
+    num--;
+  }
+}
+
+void GxIO::writeAddrMSBfirst(uint16_t d)
+{
+  writeData16(d);
+}
+
+void GxIO::startTransaction()
+{
+}
+
+void GxIO::endTransaction()
+{
+}
+
+void GxIO::setBackLight(bool lit)
+{
+}
+
 uint8_t GxIO::transferTransaction(uint8_t d)
 {
   writeDataTransaction(d);
@@ -41,5 +159,72 @@ uint32_t GxIO::readRawData32(uint8_t part)
   return 0;
 };
 
+void GxIO::writeDataTransaction(const uint8_t* data, uint32_t n, bool invert)
+{
+  startTransaction();
+  while (n > 0)
+  {
+    writeData(invert ? ~*data : *data);
+    data++;
+    n--;
+  }
+  endTransaction();
+}
+
+void GxIO::writeCommandData(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  startTransaction();
+  writeCommand(c);
+  while (n > 0)
+  {
+    writeData(*data++);
+    n--;
+  }
+  endTransaction();
+}
+
+void GxIO::writeCommandData(uint8_t c, uint8_t d)
+{
+  writeCommandData(c, &d, 1);
+}
+
+void GxIO::writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  startTransaction();
+  writeCommand(c);
+  while (n > 0)
+  {
+    writeData(pgm_read_byte(data));
+    data++;
+    n--;
+  }
+  endTransaction();
+}
 
+void GxIO::writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert)
+{
+  startTransaction();
+  while (n > 0)
+  {
+    uint8_t d = pgm_read_byte(data);
+    writeData(invert ? ~d : d);
+    data++;
+    n--;
+  }
+  endTransaction();
+}
 
+void GxIO::waitReady(int8_t busy, uint8_t busy_level, uint32_t max_ms)
+{
+  if (busy < 0)
+  {
+    delay(max_ms);
+    return;
+  }
+  delayMicroseconds(GxIO_RESET_READY_MIN_US);
+  unsigned long start = micros();
+  while ((digitalRead(busy) == busy_level) && (micros() - start < max_ms * 1000ul))
+  {
+    delayMicroseconds(100);
+  }
+}
@@ -9,11 +9,58 @@
 
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
+// transfer statistics (GxIO::getStatistics()) and busy wait statistics (GxEPD::getStatistics()) are compiled in
+// only with GxEPD_STATISTICS defined for the whole build, e.g. by build flag -DGxEPD_STATISTICS
+
+// number of distinct commands counted per command, further commands are counted in commands_not_listed
+#if defined(__AVR)
+#define GxIO_STATISTICS_COMMANDS 8
+#else
+#define GxIO_STATISTICS_COMMANDS 32
+#endif
+
+// minimum time after reset before BUSY is valid, for GxIO::waitReady()
+#ifndef GxIO_RESET_READY_MIN_US
+#define GxIO_RESET_READY_MIN_US 1000
+#endif
+
+// transfer statistics, counted by io classes that support it (GxIO_SPI), since construction or resetStatistics()
+struct GxIO_Statistics
+{
+  uint32_t command_bytes; // bytes sent with DC low
+  uint32_t data_bytes; // bytes sent with DC high, including command parameters
+  uint32_t read_bytes;
+  uint32_t transactions; // SPI bus transactions
+  uint32_t cs_toggles; // chip select assertions
+  uint32_t transfer_us; // time spent in transactions
+  uint32_t commands_not_listed; // command bytes not in command_counts, table full
+  uint8_t commands_listed; // entries used in command_counts, in order of first use
+  struct
+  {
+    uint8_t command;
+    uint32_t count;
+  } command_counts[GxIO_STATISTICS_COMMANDS];
+};
+
 class GxIO
 {
   public:
-    GxIO() {};
+    GxIO()
+    {
+#if defined(GxEPD_STATISTICS)
+      resetStatistics();
+#endif
+    };
     const char* name = "GxIO";
+#if defined(GxEPD_STATISTICS)
+    const GxIO_Statistics& getStatistics() const
+    {
+      return _statistics;
+    };
+    void resetStatistics();
+    // count of command c since resetStatistics(), 0 if not listed
+    uint32_t getCommandCount(uint8_t c) const;
+#endif
     virtual void reset();
     virtual void init();
     virtual void setFrequency(uint32_t freq){}; // for SPI
@@ -27,6 +74,23 @@ class GxIO
     virtual uint32_t readRawData32(uint8_t part); // debug purpose
     virtual void writeCommandTransaction(uint8_t c);
     virtual void writeDataTransaction(uint8_t d);
+    // burst write of n data bytes, CS kept asserted for the whole burst, bytes inverted if invert
+    virtual void writeDataTransaction(const uint8_t* data, uint32_t n, bool invert = false);
+    // same for data in program memory (PROGMEM)
+    virtual void writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert = false);
+    // command followed by its n parameter bytes, in one transaction
+    virtual void writeCommandData(uint8_t c, const uint8_t* data, uint32_t n);
+    // command followed by one parameter byte, in one transaction
+    virtual void writeCommandData(uint8_t c, uint8_t d);
+    // same for parameters in program memory (PROGMEM)
+    virtual void writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n);
+    // burst write that may return before the data is sent, data may be reused on return, synchronous by default
+    virtual void writeDataTransactionAsync(const uint8_t* data, uint32_t n, bool invert = false)
+    {
+      writeDataTransaction(data, n, invert);
+    };
+    // wait until all asynchronous transfers are complete
+    virtual void waitTransferComplete() {};
     virtual void writeData16Transaction(uint16_t d, uint32_t num = 1);
     virtual void writeCommand(uint8_t c);
     virtual void writeData(uint8_t d);
@@ -37,6 +101,79 @@ class GxIO
     virtual void endTransaction();
     virtual void selectRegister(bool rs_low) {}; // for generalized readData & writeData (RA8875)
     virtual void setBackLight(bool lit);
+    // BUSY pin of the controller and its level while busy, for reset(), set by the display classes before init()
+    virtual void setBusyPin(int8_t busy, uint8_t busy_level) {};
+    // waits after reset until BUSY is not busy_level, at least GxIO_RESET_READY_MIN_US and at most max_ms
+    // waits max_ms if busy < 0, the fixed delay of controllers without BUSY pin
+    static void waitReady(int8_t busy, uint8_t busy_level, uint32_t max_ms);
+  protected:
+#if defined(GxEPD_STATISTICS)
+    inline void _countTransactionStart()
+    {
+      _statistics.transactions++;
+      _statistics.cs_toggles++;
+      _transaction_start = micros();
+    };
+    inline void _countTransactionEnd()
+    {
+      _statistics.transfer_us += micros() - _transaction_start;
+    };
+    inline void _countData(uint32_t n)
+    {
+      _statistics.data_bytes += n;
+    };
+    inline void _countRead(uint32_t n)
+    {
+      _statistics.read_bytes += n;
+    };
+    void _countCommand(uint8_t c);
+    GxIO_Statistics _statistics;
+    uint32_t _transaction_start;
+#else
+    inline void _countTransactionStart() {};
+    inline void _countTransactionEnd() {};
+    inline void _countData(uint32_t n) {};
+    inline void _countRead(uint32_t n) {};
+    inline void _countCommand(uint8_t c) {};
+#endif
+};
+
+// GxIO_Burst : collects data bytes produced one by one in a transfer loop and sends them as bursts,
+// write() is inline, one virtual call per burst instead of one per byte; sends the rest on flush() or destruction
+class GxIO_Burst
+{
+  public:
+    // in_transaction : bursts are sent within the transaction of the caller, else each in its own transaction
+    GxIO_Burst(GxIO& io, bool in_transaction = false) : _io(io), _in_transaction(in_transaction), _n(0) {};
+    ~GxIO_Burst()
+    {
+      flush();
+    };
+    inline void write(uint8_t d)
+    {
+      _buffer[_n++] = d;
+      if (_n == sizeof(_buffer)) flush();
+    };
+    void fill(uint8_t d, uint32_t n)
+    {
+      while (n-- > 0) write(d);
+    };
+    void flush()
+    {
+      if (_n == 0) return;
+      if (_in_transaction) _io.writeData(_buffer, _n);
+      else _io.writeDataTransaction(_buffer, _n);
+      _n = 0;
+    };
+  private:
+    GxIO& _io;
+    bool _in_transaction;
+    uint8_t _n;
+#if defined(__AVR)
+    uint8_t _buffer[32];
+#else
+    uint8_t _buffer[128];
+#endif
 };
 
 #endif
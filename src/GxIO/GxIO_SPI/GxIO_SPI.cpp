@@ -5,14 +5,65 @@
 
 #include "GxIO_SPI.h"
 
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
 #if defined(PARTICLE)
 // transfer16 is not used by GxEPD
 #define transfer16 transfer
 #endif
 
+GxIO_SPI_OutputPin::GxIO_SPI_OutputPin() : _pin(-1)
+#if defined(__AVR)
+  , _port(0), _mask(0)
+#elif defined(ESP8266) || defined(ESP32)
+  , _set(0), _clr(0), _mask(0)
+#endif
+{
+}
+
+void GxIO_SPI_OutputPin::init(int8_t pin)
+{
+  _pin = pin;
+  if (pin < 0) return;
+#if defined(__AVR)
+  uint8_t port = digitalPinToPort(pin);
+  if (port != NOT_A_PIN)
+  {
+    _port = portOutputRegister(port);
+    _mask = digitalPinToBitMask(pin);
+  }
+#elif defined(ESP8266)
+  if (pin < 16) // GPIO16 is not on the GPIO registers
+  {
+    _set = &GPOS;
+    _clr = &GPOC;
+    _mask = 1UL << pin;
+  }
+#elif defined(ESP32)
+  if (pin < 32)
+  {
+    _set = (volatile uint32_t*)GPIO_OUT_W1TS_REG;
+    _clr = (volatile uint32_t*)GPIO_OUT_W1TC_REG;
+    _mask = 1UL << pin;
+  }
+#if defined(GPIO_OUT1_W1TS_REG)
+  else
+  {
+    _set = (volatile uint32_t*)GPIO_OUT1_W1TS_REG;
+    _clr = (volatile uint32_t*)GPIO_OUT1_W1TC_REG;
+    _mask = 1UL << (pin - 32);
+  }
+#endif
+#endif
+}
+
 GxIO_SPI::GxIO_SPI(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst, int8_t bl) :
   _spi(spi), _spi_settings(4000000, MSBFIRST, SPI_MODE0),
-  _cs(cs), _dc(dc), _rst(rst), _bl(bl)
+  _cs(cs), _dc(dc), _rst(rst), _bl(bl), _busy(-1), _busy_level(HIGH)
 {
 }
 
@@ -24,7 +75,7 @@ void GxIO_SPI::reset()
     digitalWrite(_rst, LOW);
     delay(20);
     digitalWrite(_rst, HIGH);
-    delay(200);
+    waitReady(_busy, _busy_level, 200); // fixed 200ms if BUSY unknown
   }
 }
 
@@ -50,12 +101,15 @@ void GxIO_SPI::init()
     digitalWrite(_bl, HIGH);
     pinMode(_bl, OUTPUT);
   }
+  if (_busy >= 0) pinMode(_busy, INPUT);
   reset();
   _spi.begin();
   if (_dc == MISO) // may be overridden, TTGO T5 V2.66
   {
     pinMode(_dc, OUTPUT);
   }
+  _cs_pin.init(_cs);
+  _dc_pin.init(_dc);
 }
 
 void GxIO_SPI::setFrequency(uint32_t freq)
@@ -66,9 +120,13 @@ void GxIO_SPI::setFrequency(uint32_t freq)
 uint8_t GxIO_SPI::transferTransaction(uint8_t d)
 {
   _spi.beginTransaction(_spi_settings);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _cs_pin.low();
   uint8_t rv = _spi.transfer(d);
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _countData(1);
+  _countRead(1);
+  _cs_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
   return rv;
 }
@@ -76,9 +134,13 @@ uint8_t GxIO_SPI::transferTransaction(uint8_t d)
 uint16_t GxIO_SPI::transfer16Transaction(uint16_t d)
 {
   _spi.beginTransaction(_spi_settings);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _cs_pin.low();
   uint16_t rv = _spi.transfer16(d);
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _countData(2);
+  _countRead(2);
+  _cs_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
   return rv;
 }
@@ -86,9 +148,12 @@ uint16_t GxIO_SPI::transfer16Transaction(uint16_t d)
 uint8_t GxIO_SPI::readDataTransaction()
 {
   _spi.beginTransaction(_spi_settings);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _cs_pin.low();
   uint8_t rv = _spi.transfer(0xFF);
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _countRead(1);
+  _cs_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
   return rv;
 }
@@ -96,9 +161,12 @@ uint8_t GxIO_SPI::readDataTransaction()
 uint16_t GxIO_SPI::readData16Transaction()
 {
   _spi.beginTransaction(_spi_settings);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _cs_pin.low();
   uint16_t rv = _spi.transfer16(0xFFFF);
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _countRead(2);
+  _cs_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
   return rv;
 }
@@ -106,58 +174,172 @@ uint16_t GxIO_SPI::readData16Transaction()
 uint8_t GxIO_SPI::readData()
 {
   uint8_t rv = _spi.transfer(0xFF);
+  _countRead(1);
   return rv;
 }
 
 uint16_t GxIO_SPI::readData16()
 {
   uint16_t rv = _spi.transfer16(0xFFFF);
+  _countRead(2);
   return rv;
 }
 
 void GxIO_SPI::writeCommandTransaction(uint8_t c)
 {
   _spi.beginTransaction(_spi_settings);
-  if (_dc >= 0) digitalWrite(_dc, LOW);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _dc_pin.low();
+  _cs_pin.low();
   _spi.transfer(c);
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
-  if (_dc >= 0) digitalWrite(_dc, HIGH);
+  _countCommand(c);
+  _cs_pin.high();
+  _dc_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
 }
 
 void GxIO_SPI::writeDataTransaction(uint8_t d)
 {
   _spi.beginTransaction(_spi_settings);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _cs_pin.low();
   _spi.transfer(d);
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _countData(1);
+  _cs_pin.high();
+  _countTransactionEnd();
+  _spi.endTransaction();
+}
+
+void GxIO_SPI::writeDataTransaction(const uint8_t* data, uint32_t n, bool invert)
+{
+  _spi.beginTransaction(_spi_settings);
+  _countTransactionStart();
+  _countData(n);
+  _cs_pin.low();
+#if defined(ESP8266) || defined(ESP32)
+  if (!invert)
+  {
+    _spi.writeBytes((uint8_t*)data, n);
+  }
+  else
+  {
+    uint8_t chunk[32]; // invert in small chunks, keep the bulk transfer of the SPI driver
+    while (n > 0)
+    {
+      uint32_t c = n < sizeof(chunk) ? n : sizeof(chunk);
+      for (uint32_t i = 0; i < c; i++) chunk[i] = ~data[i];
+      _spi.writeBytes(chunk, c);
+      data += c;
+      n -= c;
+    }
+  }
+#else
+  uint8_t mask = invert ? 0xFF : 0x00;
+  while (n > 0)
+  {
+    _spi.transfer(*data ^ mask);
+    data++;
+    n--;
+  }
+#endif
+  _cs_pin.high();
+  _countTransactionEnd();
+  _spi.endTransaction();
+}
+
+void GxIO_SPI::writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert)
+{
+  uint8_t mask = invert ? 0xFF : 0x00;
+  _spi.beginTransaction(_spi_settings);
+  _countTransactionStart();
+  _countData(n);
+  _cs_pin.low();
+  while (n > 0)
+  {
+    _spi.transfer(pgm_read_byte(data) ^ mask);
+    data++;
+    n--;
+  }
+  _cs_pin.high();
+  _countTransactionEnd();
+  _spi.endTransaction();
+}
+
+void GxIO_SPI::writeCommandData(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  _spi.beginTransaction(_spi_settings);
+  _countTransactionStart();
+  _dc_pin.low();
+  _cs_pin.low();
+  _spi.transfer(c);
+  _countCommand(c);
+  _countData(n);
+  _dc_pin.high();
+  while (n > 0)
+  {
+    _spi.transfer(*data++);
+    n--;
+  }
+  _cs_pin.high();
+  _countTransactionEnd();
+  _spi.endTransaction();
+}
+
+void GxIO_SPI::writeCommandData(uint8_t c, uint8_t d)
+{
+  writeCommandData(c, &d, 1);
+}
+
+void GxIO_SPI::writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  _spi.beginTransaction(_spi_settings);
+  _countTransactionStart();
+  _dc_pin.low();
+  _cs_pin.low();
+  _spi.transfer(c);
+  _countCommand(c);
+  _countData(n);
+  _dc_pin.high();
+  while (n > 0)
+  {
+    _spi.transfer(pgm_read_byte(data));
+    data++;
+    n--;
+  }
+  _cs_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
 }
 
 void GxIO_SPI::writeData16Transaction(uint16_t d, uint32_t num)
 {
   _spi.beginTransaction(_spi_settings);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _cs_pin.low();
   writeData16(d, num);
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _cs_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
 }
 
 void GxIO_SPI::writeCommand(uint8_t c)
 {
-  if (_dc >= 0) digitalWrite(_dc, LOW);
+  _dc_pin.low();
   _spi.transfer(c);
-  if (_dc >= 0) digitalWrite(_dc, HIGH);
+  _countCommand(c);
+  _dc_pin.high();
 }
 
 void GxIO_SPI::writeData(uint8_t d)
 {
   _spi.transfer(d);
+  _countData(1);
 }
 
 void GxIO_SPI::writeData(uint8_t* d, uint32_t num)
 {
+  _countData(num);
 #if defined(ESP8266) || defined(ESP32)
   _spi.writeBytes(d, num);
 #else
@@ -172,6 +354,7 @@ void GxIO_SPI::writeData(uint8_t* d, uint32_t num)
 
 void GxIO_SPI::writeData16(uint16_t d, uint32_t num)
 {
+  _countData(2 * num);
 #if defined(ESP8266) || defined(ESP32)
   uint8_t b[2] = {uint8_t(d >> 8), uint8_t(d)};
   _spi.writePattern(b, 2, num);
@@ -186,6 +369,7 @@ void GxIO_SPI::writeData16(uint16_t d, uint32_t num)
 
 void GxIO_SPI::writeAddrMSBfirst(uint16_t d)
 {
+  _countData(2);
   _spi.transfer(d >> 8);
   _spi.transfer(d & 0xFF);
 }
@@ -193,21 +377,30 @@ void GxIO_SPI::writeAddrMSBfirst(uint16_t d)
 void GxIO_SPI::startTransaction()
 {
   _spi.beginTransaction(_spi_settings);
-  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _countTransactionStart();
+  _cs_pin.low();
 }
 
 void GxIO_SPI::endTransaction()
 {
-  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  _cs_pin.high();
+  _countTransactionEnd();
   _spi.endTransaction();
 }
 
 void GxIO_SPI::selectRegister(bool rs_low)
 {
-  if (_dc >= 0) digitalWrite(_dc, (rs_low ? LOW : HIGH));
+  if (rs_low) _dc_pin.low();
+  else _dc_pin.high();
 }
 
 void GxIO_SPI::setBackLight(bool lit)
 {
   if (_bl >= 0) digitalWrite(_bl, (lit ? HIGH : LOW));
 }
+
+void GxIO_SPI::setBusyPin(int8_t busy, uint8_t busy_level)
+{
+  _busy = busy;
+  _busy_level = busy_level;
+}
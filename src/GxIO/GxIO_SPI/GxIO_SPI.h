@@ -8,6 +8,62 @@
 #include <SPI.h>
 #include "../GxIO.h"
 
+#if defined(ESP32)
+#include <soc/gpio_reg.h>
+#endif
+
+// output pin set by direct port register write, port and mask cached at init(), digitalWrite() if not available
+class GxIO_SPI_OutputPin
+{
+  public:
+    GxIO_SPI_OutputPin();
+    void init(int8_t pin);
+    void low()
+    {
+#if defined(__AVR)
+      if (_port)
+      {
+        *_port &= ~_mask;
+        return;
+      }
+#elif defined(ESP8266) || defined(ESP32)
+      if (_clr)
+      {
+        *_clr = _mask;
+        return;
+      }
+#endif
+      if (_pin >= 0) digitalWrite(_pin, LOW);
+    };
+    void high()
+    {
+#if defined(__AVR)
+      if (_port)
+      {
+        *_port |= _mask;
+        return;
+      }
+#elif defined(ESP8266) || defined(ESP32)
+      if (_set)
+      {
+        *_set = _mask;
+        return;
+      }
+#endif
+      if (_pin >= 0) digitalWrite(_pin, HIGH);
+    };
+  private:
+    int8_t _pin;
+#if defined(__AVR)
+    volatile uint8_t* _port;
+    uint8_t _mask;
+#elif defined(ESP8266) || defined(ESP32)
+    volatile uint32_t* _set; // write 1 to set registers
+    volatile uint32_t* _clr; // write 1 to clear registers
+    uint32_t _mask;
+#endif
+};
+
 class GxIO_SPI : public GxIO
 {
   public:
@@ -24,6 +80,11 @@ class GxIO_SPI : public GxIO
     uint16_t readData16();
     void writeCommandTransaction(uint8_t c);
     void writeDataTransaction(uint8_t d);
+    void writeDataTransaction(const uint8_t* data, uint32_t n, bool invert = false);
+    void writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert = false);
+    void writeCommandData(uint8_t c, const uint8_t* data, uint32_t n);
+    void writeCommandData(uint8_t c, uint8_t d);
+    void writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n);
     void writeData16Transaction(uint16_t d, uint32_t num = 1);
     void writeCommand(uint8_t c);
     void writeData(uint8_t d);
@@ -34,10 +95,14 @@ class GxIO_SPI : public GxIO
     void endTransaction();
     void selectRegister(bool rs_low); // for generalized readData & writeData (RA8875)
     void setBackLight(bool lit);
+    void setBusyPin(int8_t busy, uint8_t busy_level);
   protected:
     SPIClass& _spi;
     SPISettings _spi_settings;
     int8_t _cs, _dc, _rst, _bl; // Control lines
+    int8_t _busy; // input, for reset()
+    uint8_t _busy_level;
+    GxIO_SPI_OutputPin _cs_pin, _dc_pin;
 };
 
 #define GxIO_Class GxIO_SPI
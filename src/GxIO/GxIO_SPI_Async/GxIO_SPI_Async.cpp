@@ -0,0 +1,289 @@
+// GxIO_SPI_Async : GxIO_SPI with asynchronous double-buffered data transfer for the GxEPD library
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+//
+
+#include "GxIO_SPI_Async.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP32)
+
+GxIO_SPI_Async::Semaphore::Semaphore(uint8_t max_count, uint8_t initial_count) :
+  _handle(xSemaphoreCreateCounting(max_count, initial_count))
+{
+}
+
+GxIO_SPI_Async::Semaphore::~Semaphore()
+{
+  vSemaphoreDelete(_handle);
+}
+
+void GxIO_SPI_Async::Semaphore::give()
+{
+  xSemaphoreGive(_handle);
+}
+
+void GxIO_SPI_Async::Semaphore::take()
+{
+  xSemaphoreTake(_handle, portMAX_DELAY);
+}
+
+#elif GxIO_SPI_Async_THREADED
+
+GxIO_SPI_Async::Semaphore::Semaphore(uint8_t max_count, uint8_t initial_count) : _count(initial_count)
+{
+}
+
+GxIO_SPI_Async::Semaphore::~Semaphore()
+{
+}
+
+void GxIO_SPI_Async::Semaphore::give()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _count++;
+  _cv.notify_one();
+}
+
+void GxIO_SPI_Async::Semaphore::take()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (_count == 0) _cv.wait(lock);
+  _count--;
+}
+
+#else
+
+GxIO_SPI_Async::Semaphore::Semaphore(uint8_t max_count, uint8_t initial_count)
+{
+}
+
+GxIO_SPI_Async::Semaphore::~Semaphore()
+{
+}
+
+void GxIO_SPI_Async::Semaphore::give()
+{
+}
+
+void GxIO_SPI_Async::Semaphore::take()
+{
+}
+
+#endif
+
+GxIO_SPI_Async::GxIO_SPI_Async(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst, int8_t bl, uint32_t chunk_size) :
+  GxIO_SPI(spi, cs, dc, rst, bl), _chunk_size(chunk_size), _head(0), _tail(0),
+  _worker_running(false), _stop(false), _callback(0), _callback_p(0),
+  _free_slots(2, 2), _full_slots(2, 0)
+{
+  _slot_data[0] = _slot_data[1] = 0;
+  _slot_size[0] = _slot_size[1] = 0;
+}
+
+GxIO_SPI_Async::~GxIO_SPI_Async()
+{
+  if (_worker_running)
+  {
+    waitTransferComplete();
+    _stop = true;
+    _full_slots.give(); // wake up worker to see _stop
+#if defined(ESP32)
+    while (_stop) vTaskDelay(1); // worker acknowledges stop
+#elif GxIO_SPI_Async_THREADED
+    _thread.join();
+#endif
+  }
+  free(_slot_data[0]);
+  free(_slot_data[1]);
+}
+
+void GxIO_SPI_Async::init()
+{
+  waitTransferComplete();
+  GxIO_SPI::init();
+  _startWorker();
+}
+
+void GxIO_SPI_Async::_startWorker()
+{
+#if GxIO_SPI_Async_THREADED
+  if (_worker_running) return;
+  _slot_data[0] = (uint8_t*) malloc(_chunk_size);
+  _slot_data[1] = (uint8_t*) malloc(_chunk_size);
+  if (!_slot_data[0] || !_slot_data[1] || (_chunk_size == 0))
+  {
+    // not enough memory, fall back to synchronous transfer
+    free(_slot_data[0]);
+    free(_slot_data[1]);
+    _slot_data[0] = _slot_data[1] = 0;
+    return;
+  }
+#if defined(ESP32)
+  // run on the other core, so rendering and transfer really overlap
+  BaseType_t core = xPortGetCoreID() ? 0 : 1;
+  _worker_running = (pdPASS == xTaskCreatePinnedToCore(_workerTask, "GxIO_SPI_Async", 2048, this, uxTaskPriorityGet(NULL), &_task, core));
+#else
+  _thread = std::thread(&GxIO_SPI_Async::_worker, this);
+  _worker_running = true;
+#endif
+#endif
+}
+
+#if defined(ESP32)
+void GxIO_SPI_Async::_workerTask(void* p)
+{
+  GxIO_SPI_Async* io = (GxIO_SPI_Async*) p;
+  io->_worker();
+  io->_stop = false; // acknowledge stop
+  vTaskDelete(NULL);
+}
+#endif
+
+void GxIO_SPI_Async::_worker()
+{
+  while (true)
+  {
+    _full_slots.take();
+    if (_stop) break;
+    GxIO_SPI::writeDataTransaction(_slot_data[_tail], _slot_size[_tail], false);
+    _tail ^= 1;
+    if (_callback) _callback(_callback_p);
+    _free_slots.give();
+  }
+}
+
+void GxIO_SPI_Async::setTransferCompleteCallback(void (*callback)(const void*), const void* p)
+{
+  waitTransferComplete();
+  _callback = callback;
+  _callback_p = p;
+}
+
+void GxIO_SPI_Async::writeDataTransactionAsync(const uint8_t* data, uint32_t n, bool invert)
+{
+  if (!_worker_running)
+  {
+    GxIO_SPI::writeDataTransaction(data, n, invert);
+    if (_callback) _callback(_callback_p);
+    return;
+  }
+  while (n > 0)
+  {
+    uint32_t chunk = n < _chunk_size ? n : _chunk_size;
+    _free_slots.take();
+    uint8_t* slot = _slot_data[_head];
+    if (invert)
+    {
+      for (uint32_t i = 0; i < chunk; i++) slot[i] = ~data[i];
+    }
+    else memcpy(slot, data, chunk);
+    _slot_size[_head] = chunk;
+    _head ^= 1;
+    _full_slots.give();
+    data += chunk;
+    n -= chunk;
+  }
+}
+
+void GxIO_SPI_Async::waitTransferComplete()
+{
+  if (!_worker_running) return;
+  // both slots free means nothing pending
+  _free_slots.take();
+  _free_slots.take();
+  _free_slots.give();
+  _free_slots.give();
+}
+
+void GxIO_SPI_Async::reset()
+{
+  waitTransferComplete();
+  GxIO_SPI::reset();
+}
+
+void GxIO_SPI_Async::setFrequency(uint32_t freq)
+{
+  waitTransferComplete();
+  GxIO_SPI::setFrequency(freq);
+}
+
+uint8_t GxIO_SPI_Async::transferTransaction(uint8_t d)
+{
+  waitTransferComplete();
+  return GxIO_SPI::transferTransaction(d);
+}
+
+uint16_t GxIO_SPI_Async::transfer16Transaction(uint16_t d)
+{
+  waitTransferComplete();
+  return GxIO_SPI::transfer16Transaction(d);
+}
+
+uint8_t GxIO_SPI_Async::readDataTransaction()
+{
+  waitTransferComplete();
+  return GxIO_SPI::readDataTransaction();
+}
+
+uint16_t GxIO_SPI_Async::readData16Transaction()
+{
+  waitTransferComplete();
+  return GxIO_SPI::readData16Transaction();
+}
+
+void GxIO_SPI_Async::writeCommandTransaction(uint8_t c)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeCommandTransaction(c);
+}
+
+void GxIO_SPI_Async::writeDataTransaction(uint8_t d)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeDataTransaction(d);
+}
+
+void GxIO_SPI_Async::writeDataTransaction(const uint8_t* data, uint32_t n, bool invert)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeDataTransaction(data, n, invert);
+}
+
+void GxIO_SPI_Async::writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeDataTransactionPGM(data, n, invert);
+}
+
+void GxIO_SPI_Async::writeCommandData(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeCommandData(c, data, n);
+}
+
+void GxIO_SPI_Async::writeCommandData(uint8_t c, uint8_t d)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeCommandData(c, d);
+}
+
+void GxIO_SPI_Async::writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeCommandDataPGM(c, data, n);
+}
+
+void GxIO_SPI_Async::writeData16Transaction(uint16_t d, uint32_t num)
+{
+  waitTransferComplete();
+  GxIO_SPI::writeData16Transaction(d, num);
+}
+
+void GxIO_SPI_Async::startTransaction()
+{
+  waitTransferComplete();
+  GxIO_SPI::startTransaction();
+}
@@ -0,0 +1,95 @@
+// GxIO_SPI_Async : GxIO_SPI with asynchronous double-buffered data transfer for the GxEPD library
+//
+// writeDataTransactionAsync() copies the data into one of two queue slots and returns,
+// a worker sends the slots in order, so the next page can be rendered while the previous one is sent.
+// worker: FreeRTOS task on the other core on ESP32, std::thread on host builds (no ARDUINO defined),
+// synchronous fallback on other targets or if the slots can't be allocated.
+//
+// License: GNU GENERAL PUBLIC LICENSE V3, see LICENSE
+
+#ifndef _GxIO_SPI_Async_H_
+#define _GxIO_SPI_Async_H_
+
+#include "../GxIO_SPI/GxIO_SPI.h"
+
+#if defined(ESP32)
+#define GxIO_SPI_Async_THREADED 1
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#elif !defined(ARDUINO)
+#define GxIO_SPI_Async_THREADED 1
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#else
+#define GxIO_SPI_Async_THREADED 0
+#endif
+
+class GxIO_SPI_Async : public GxIO_SPI
+{
+  public:
+    // chunk_size : size of each of the two queue slots, e.g. the page size of the display class
+    GxIO_SPI_Async(SPIClass& spi, int8_t cs, int8_t dc, int8_t rst = -1, int8_t bl = -1, uint32_t chunk_size = 2048);
+    ~GxIO_SPI_Async();
+    const char* name = "GxIO_SPI_Async";
+    void init();
+    // callback is called from the worker after each chunk has been sent
+    void setTransferCompleteCallback(void (*callback)(const void*), const void* p = 0);
+    void writeDataTransactionAsync(const uint8_t* data, uint32_t n, bool invert = false);
+    void waitTransferComplete();
+    // all synchronous methods wait for pending asynchronous transfers first
+    void reset();
+    void setFrequency(uint32_t freq);
+    uint8_t transferTransaction(uint8_t d);
+    uint16_t transfer16Transaction(uint16_t d);
+    uint8_t readDataTransaction();
+    uint16_t readData16Transaction();
+    void writeCommandTransaction(uint8_t c);
+    void writeDataTransaction(uint8_t d);
+    void writeDataTransaction(const uint8_t* data, uint32_t n, bool invert = false);
+    void writeDataTransactionPGM(const uint8_t* data, uint32_t n, bool invert = false);
+    void writeCommandData(uint8_t c, const uint8_t* data, uint32_t n);
+    void writeCommandData(uint8_t c, uint8_t d);
+    void writeCommandDataPGM(uint8_t c, const uint8_t* data, uint32_t n);
+    void writeData16Transaction(uint16_t d, uint32_t num = 1);
+    void startTransaction();
+  private:
+    class Semaphore
+    {
+      public:
+        Semaphore(uint8_t max_count, uint8_t initial_count);
+        ~Semaphore();
+        void give();
+        void take();
+      private:
+#if defined(ESP32)
+        SemaphoreHandle_t _handle;
+#elif GxIO_SPI_Async_THREADED
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        uint8_t _count;
+#endif
+    };
+    void _startWorker();
+    void _worker();
+#if defined(ESP32)
+    static void _workerTask(void* p);
+#endif
+    uint8_t* _slot_data[2];
+    uint32_t _slot_size[2];
+    uint32_t _chunk_size;
+    uint8_t _head, _tail; // _head written by caller only, _tail by worker only
+    bool _worker_running;
+    volatile bool _stop;
+    void (*_callback)(const void*);
+    const void* _callback_p;
+    Semaphore _free_slots, _full_slots;
+#if defined(ESP32)
+    TaskHandle_t _task;
+#elif GxIO_SPI_Async_THREADED
+    std::thread _thread;
+#endif
+};
+
+#endif
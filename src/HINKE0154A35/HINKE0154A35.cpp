@@ -91,8 +91,9 @@ void HINKE0154A35::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -121,6 +122,7 @@ void HINKE0154A35::fillScreen(uint16_t color)
     _black_buffer[x] = black;
     _red_buffer[x] = red;
   }
+  bufferFilled(color);
 }
 
 void HINKE0154A35::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
@@ -132,75 +134,73 @@ void HINKE0154A35::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uin
 
 void HINKE0154A35::drawExamplePicture(const uint8_t *black_bitmap, const uint8_t *red_bitmap, uint32_t black_size, uint32_t red_size)
 {
+  invalidateShadow();
   drawPicture(black_bitmap, red_bitmap, black_size, red_size, bm_invert_red);
 }
 
 void HINKE0154A35::drawPicture(const uint8_t *black_bitmap, const uint8_t *red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
+  invalidateShadow();
   drawBitmapBM(black_bitmap, 0, 0, HINKE0154A35_WIDTH, HINKE0154A35_HEIGHT, GxEPD_BLACK, mode);
   drawBitmapBM(red_bitmap, 0, 0, HINKE0154A35_WIDTH, HINKE0154A35_HEIGHT, GxEPD_RED, mode);
 }
 
 void HINKE0154A35::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   drawBitmapBM(bitmap, 0, 0, HINKE0154A35_WIDTH, HINKE0154A35_HEIGHT, GxEPD_BLACK, mode);
 }
 
 void HINKE0154A35::update(void)
 {
+  bufferUpdated();
   // reset required for wakeup
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, HIGH, 10); // 10ms if no BUSY
   }
   // 1.54 Zoll Display:
   _writeCommand(0x12);
   _waitWhileBusy("SendResetfirst");
   delay(5);
 
-  _writeCommand(0x74);
-  _writeData(0x54);
+  IO.writeCommandData(0x74, 0x54);
 
-  _writeCommand(0x7E);
-  _writeData(0x3B);
+  IO.writeCommandData(0x7E, 0x3B);
 
-  _writeCommand(0x2B);
-  _writeData(0x04);
-  _writeData(0x63);
+  {
+    const uint8_t data[] = {0x04, 0x63};
+    IO.writeCommandData(0x2B, data, sizeof(data));
+  }
 
-  _writeCommand(0x0C);
-  _writeData(0x8F);
-  _writeData(0x8F);
-  _writeData(0x8F);
-  _writeData(0x3F);
-
-  _writeCommand(0x01);
-  _writeData(0x97);
-  _writeData(0x00);
-  _writeData(0x00);
-
-  _writeCommand(0x11);
-  _writeData(0x02);
-
-  _writeCommand(0x44);
-  _writeData(0x12);
-  _writeData(0x00);
-
-  _writeCommand(0x45);
-  _writeData(0x00);
-  _writeData(0x00);
-  _writeData(0x97);
-  _writeData(0x00);
-
-  _writeCommand(0x3C);
-  _writeData(0x01);
-  _writeCommand(0x18);
-  _writeData(0x80);
-  _writeCommand(0x22);
-  _writeData(0xB1);
+  {
+    const uint8_t data[] = {0x8F, 0x8F, 0x8F, 0x3F};
+    IO.writeCommandData(0x0C, data, sizeof(data));
+  }
+
+  {
+    const uint8_t data[] = {0x97, 0x00, 0x00};
+    IO.writeCommandData(0x01, data, sizeof(data));
+  }
+
+  IO.writeCommandData(0x11, 0x02);
+
+  {
+    const uint8_t data[] = {0x12, 0x00};
+    IO.writeCommandData(0x44, data, sizeof(data));
+  }
+
+  {
+    const uint8_t data[] = {0x00, 0x00, 0x97, 0x00};
+    IO.writeCommandData(0x45, data, sizeof(data));
+  }
+
+  IO.writeCommandData(0x3C, 0x01);
+  IO.writeCommandData(0x18, 0x80);
+  IO.writeCommandData(0x22, 0xB1);
   _writeCommand(0x20);
   _waitWhileBusy("SendResetmiddle");
   delay(5);
@@ -209,36 +209,29 @@ void HINKE0154A35::update(void)
   _writeCommand(0x0C);
   _writeCommand(0xFF);
 
-  _writeCommand(0x4E);
-  _writeData(0x12);
-
-  _writeCommand(0x4F);
-  _writeData(0x00);
-  _writeData(0x00);
-
-  _writeCommand(0x26);
+  IO.writeCommandData(0x4E, 0x12);
 
-  for (uint32_t i = 0; i < HINKE0154A35_BUFFER_SIZE; i++)
   {
-    _writeData((i < sizeof(_red_buffer)) ? ~_red_buffer[i] : 0xFF);
+    const uint8_t data[] = {0x00, 0x00};
+    IO.writeCommandData(0x4F, data, sizeof(data));
   }
 
-  _writeCommand(0x4E);
-  _writeData(0x12);
+  _writeCommand(0x26);
 
-  _writeCommand(0x4F);
-  _writeData(0x00);
-  _writeData(0x00);
+  writeBufferData(IO, _red_buffer, sizeof(_red_buffer), 0, HINKE0154A35_BUFFER_SIZE, true);
 
-  _writeCommand(0x24);
+  IO.writeCommandData(0x4E, 0x12);
 
-  for (uint32_t i = 0; i < HINKE0154A35_BUFFER_SIZE; i++)
   {
-    _writeData((i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF);
+    const uint8_t data[] = {0x00, 0x00};
+    IO.writeCommandData(0x4F, data, sizeof(data));
   }
 
-  _writeCommand(0x22);
-  _writeData(0xC7);
+  _writeCommand(0x24);
+
+  writeBufferData(IO, _black_buffer, sizeof(_black_buffer), 0, HINKE0154A35_BUFFER_SIZE, true);
+
+  IO.writeCommandData(0x22, 0xC7);
 
   _writeCommand(0x20);
   _waitWhileBusy("SEND DONE");
@@ -260,18 +253,20 @@ void HINKE0154A35::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void HINKE0154A35::_waitWhileBusy(const char *comment)
+void HINKE0154A35::_waitWhileBusy(const char *comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 0)
       break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 30000000) // >14.9s !
     {
       if (_diag_enabled)
         Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -288,6 +283,7 @@ void HINKE0154A35::_waitWhileBusy(const char *comment)
 #endif
   }
   (void)start;
+  onBusyWaitDone();
 }
 
 void HINKE0154A35::_rotate(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h)
@@ -319,65 +315,63 @@ void HINKE0154A35::_wakeUp()
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, HIGH, 10); // 10ms if no BUSY
   }
   /*
-    _writeCommand(0x06);
-    _writeData (0x17);
-    _writeData (0x17);
-    _writeData (0x17);
+    {
+      const uint8_t data[] = {0x17, 0x17, 0x17};
+      IO.writeCommandData(0x06, data, sizeof(data));
+    }
     _writeCommand(0x04);
-    _waitWhileBusy("_wakeUp Power On");
-    _writeCommand(0X00);
-    _writeData(0x8f);
-    _writeCommand(0X50);
-    _writeData(0x77);
-    _writeCommand(0x61);
-    _writeData (0x80);
-    _writeData (0x01);
-    _writeData (0x28);
+    _waitWhileBusy("_wakeUp Power On", wait_power_on);
+    IO.writeCommandData(0X00, 0x8f);
+    IO.writeCommandData(0X50, 0x77);
+    {
+      const uint8_t data[] = {0x80, 0x01, 0x28};
+      IO.writeCommandData(0x61, data, sizeof(data));
+    }
     */
 }
 
 void HINKE0154A35::_sleep(void)
 {
-  _waitWhileBusy("_sleep Going to sleep.");
+  _waitWhileBusy("_sleep Going to sleep.", wait_power_off);
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // sleep!
-    _writeData(0x11);
+    IO.writeCommandData(0x10, 0x11); // sleep!
   }
 }
 
 void HINKE0154A35::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1)
     return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t y = 0; y < HINKE0154A35_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < HINKE0154A35_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < HINKE0154A35_HEIGHT; y++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if ((x < 1) && (y < 8))
-        data = 0x00;
-      if ((x > HINKE0154A35_WIDTH / 8 - 3) && (y < 16))
-        data = 0x00;
-      if ((x > HINKE0154A35_WIDTH / 8 - 4) && (y > HINKE0154A35_HEIGHT - 25))
-        data = 0x00;
-      if ((x < 4) && (y > HINKE0154A35_HEIGHT - 33))
-        data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < HINKE0154A35_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if ((x < 1) && (y < 8))
+          data = 0x00;
+        if ((x > HINKE0154A35_WIDTH / 8 - 3) && (y < 16))
+          data = 0x00;
+        if ((x > HINKE0154A35_WIDTH / 8 - 4) && (y > HINKE0154A35_HEIGHT - 25))
+          data = 0x00;
+        if ((x < 4) && (y > HINKE0154A35_HEIGHT - 33))
+          data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < HINKE0154A35_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  GxIO_Burst(IO).fill(0xFF, HINKE0154A35_BUFFER_SIZE); // white is 0xFF on device
   _writeCommand(0x12); // display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
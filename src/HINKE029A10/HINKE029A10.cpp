@@ -34,65 +34,7 @@ HINKE029A10::HINKE029A10(GxIO &io, int8_t rst, int8_t busy)
       _current_page(-1), _using_partial_mode(false), _diag_enabled(false),
       _rst(rst), _busy(busy)
 {
-}
-
-void HINKE029A10::drawPixel(int16_t x, int16_t y, uint16_t color)
-{
-  // swap(x, y);
-
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
-    return;
-
-  // x = HINKE029A10_WIDTH - x - 1;
-
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
-  {
-  case 1:
-    swap(x, y);
-    x = HINKE029A10_WIDTH - x - 1;
-    break;
-  case 2:
-    x = HINKE029A10_WIDTH - x - 1;
-    y = HINKE029A10_HEIGHT - y - 1;
-    break;
-  case 3:
-    swap(x, y);
-    y = HINKE029A10_HEIGHT - y - 1;
-    break;
-  }
-  uint16_t i = x / 8 + y * HINKE029A10_WIDTH / 8;
-  if (_current_page < 1)
-  {
-    if (i >= sizeof(_black_buffer))
-      return;
-  }
-  else
-  {
-    y -= _current_page * HINKE029A10_PAGE_HEIGHT;
-    if ((y < 0) || (y >= HINKE029A10_PAGE_HEIGHT))
-      return;
-    i = x / 8 + y * HINKE029A10_WIDTH / 8;
-  }
-
-  _black_buffer[i] = (_black_buffer[i] & (0xFF ^ (1 << (7 - x % 8)))); // white
-
-  _red_buffer[i] = (_red_buffer[i] | (1 << (7 - x % 8))); // white
-  if (color == GxEPD_WHITE)
-    return;
-  else if (color == GxEPD_BLACK)
-    _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-  else if (color == GxEPD_RED)
-    _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
-  else
-  {
-    if ((color & 0xF100) > (0xF100 / 2))
-      _red_buffer[i] = (_red_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
-    else if ((((color & 0xF100) >> 11) + ((color & 0x07E0) >> 5) + (color & 0x001F)) < 3 * 255 / 2)
-    {
-      _black_buffer[i] = (_black_buffer[i] | (1 << (7 - x % 8)));
-    }
-  }
+  setBufferLayout(buffer_3c_red_inverted, _black_buffer, _red_buffer, sizeof(_black_buffer), HINKE029A10_WIDTH / 8, HINKE029A10_PAGE_HEIGHT, &_current_page);
 }
 
 void HINKE029A10::init(uint32_t serial_diag_bitrate)
@@ -102,8 +44,9 @@ void HINKE029A10::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -111,64 +54,67 @@ void HINKE029A10::init(uint32_t serial_diag_bitrate)
   }
   pinMode(_busy, INPUT);
 
-  _writeCommand(0x74);
-  _writeData(0x54);
-  _writeCommand(0x75);
-  _writeData(0x3b);
-  _writeCommand(0x01); // Set MUX as 296
-  _writeData(0x27);
-  _writeData(0x01);
-  _writeData(0x00);
-  _writeCommand(0x3A); // Set 100Hz
-  //_writeData(0x25);         // Set 100Hz
-  _writeData(0x35); // Set 130Hz
+  IO.writeCommandData(0x74, 0x54);
+  IO.writeCommandData(0x75, 0x3b);
+  {
+    const uint8_t data[] = {0x27, 0x01, 0x00};
+    IO.writeCommandData(0x01, data, sizeof(data)); // Set MUX as 296
+  }
+  //IO.writeCommandData(0x3A, 0x25); // Set 100Hz
+  IO.writeCommandData(0x3A, 0x35); // Set 100Hz : Set 130Hz
   //_writeData(0x07);         // Set 150Hz
-  _writeCommand(0x3B); // Set 100Hz
-  //_writeData(0x06);         // Set 100Hz
-  _writeData(0x04);    // Set 130Hz
-  _writeCommand(0x11); // data enter mode
-  _writeData(0x03);
-  _writeCommand(0x44); // set RAM x address start/end, in page 36
-  _writeData(0x00);    // RAM x address start at 00h;
-  _writeData(0x0f);    // RAM x address end at 0fh(15+1)*8->128
-  _writeCommand(0x45); // set RAM y address start/end, in page 37
-
-  _writeData(0x00); // RAM y address start at 127h;
-  _writeData(0x00);
-  _writeData(0x27); // RAM y address end at 00h;
-  _writeData(0x01);
-  _writeCommand(0x04); // set VSH,VSL value
-  _writeData(0x41);    //      2D9  15v
-  // _writeData(0xc6);   //      2D13   7.8v
-  //_writeData(0xc1);    //      2D13   7.5v
-  //  _writeData(0x96);    //      2D9   3.8v
-  //  _writeData(0xbf);   //      2D13   7.3v
-  //  _writeData(0xb8);    //      2D13   6.6v
-  //_writeData(0xb4);    //      2D13   6.2v
-  //_writeData(0xb2);    //      2D13   6v
-  // _writeData(0xad);    //      2D9   5v
-  _writeData(0xa8); //      2D9   5v
-  // _writeData(0xA4);    //      2D9   4.6v
-  // _writeData(0xA2);    //      2D9   4.4v
-  // _writeData(0xa0);    //      2D9   4.2v
-  // _writeData(0x9C);    //      2D9   3.8v
-  //  _writeData(0x96);    //      2D9   3.8v
-  _writeData(0x32);    //      2D9  -15v
-  _writeCommand(0x2C); // vcom
-  // _writeData(0x78);           //-3V
-  // _writeData(0x6f);           //-2.6V
-  //  _writeData(0x6c);           //-2.6V
-  _writeData(0x68); //-2.6V
+  //IO.writeCommandData(0x3B, 0x06); // Set 100Hz
+  IO.writeCommandData(0x3B, 0x04); // Set 100Hz : Set 130Hz
+  IO.writeCommandData(0x11, 0x03); // data enter mode
+  {
+    const uint8_t data[] =
+    {
+      0x00, // RAM x address start at 00h;
+      0x0f // RAM x address end at 0fh(15+1)*8->128
+    };
+    IO.writeCommandData(0x44, data, sizeof(data)); // set RAM x address start/end, in page 36
+  }
+  {
+    const uint8_t data[] =
+    {
+      0x00, // RAM y address start at 127h;
+      0x00,
+      0x27, // RAM y address end at 00h;
+      0x01
+    };
+    IO.writeCommandData(0x45, data, sizeof(data)); // set RAM y address start/end, in page 37
+  }
+  {
+    const uint8_t data[] =
+    {
+      0x41, //      2D9  15v
+      //0xc6, //      2D13   7.8v
+      //0xc1, //      2D13   7.5v
+      //0x96, //      2D9   3.8v
+      //0xbf, //      2D13   7.3v
+      //0xb8, //      2D13   6.6v
+      //0xb4, //      2D13   6.2v
+      //0xb2, //      2D13   6v
+      //0xad, //      2D9   5v
+      0xa8, //      2D9   5v
+      //0xA4, //      2D9   4.6v
+      //0xA2, //      2D9   4.4v
+      //0xa0, //      2D9   4.2v
+      //0x9C, //      2D9   3.8v
+      //0x96, //      2D9   3.8v
+      0x32 //      2D9  -15v
+    };
+    IO.writeCommandData(0x04, data, sizeof(data)); // set VSH,VSL value
+  }
+  //IO.writeCommandData(0x2C, 0x78); //-3V
+  //IO.writeCommandData(0x2C, 0x6f); //-2.6V
+  //IO.writeCommandData(0x2C, 0x6c); //-2.6V
+  IO.writeCommandData(0x2C, 0x68); // vcom : -2.6V
   // _writeData(0x5F);           //-2.4V
   // _writeData(0x58);           //-2.4V
-  _writeCommand(0x3C); // board
-  _writeData(0x33);    // GS1-->GS1
+  IO.writeCommandData(0x3C, 0x33); // board : GS1-->GS1
 
-  _writeCommand(0x32);
-  for (uint8_t i = 0; i < 70; i++)
-  { // write LUT register with 29bytes instead of 30bytes 2D13
-    _writeData(LUTDefault_full[i]);
-  }
+  IO.writeCommandData(0x32, LUTDefault_full, 70); // write LUT register with 29bytes instead of 30bytes 2D13
 }
 
 void HINKE029A10::fillScreen(uint16_t color)
@@ -190,17 +136,19 @@ void HINKE029A10::fillScreen(uint16_t color)
     _black_buffer[x] = black;
     _red_buffer[x] = red;
   }
+  bufferFilled(color);
 }
 
 void HINKE029A10::update(void)
 {
+  bufferUpdated();
   // reset required for wakeup
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(1);
     digitalWrite(_rst, 1);
-    delay(1);
+    GxIO::waitReady(_busy, HIGH, 1); // 1ms if no BUSY
   }
 
   set_xy_window(0, 15, 0, 295);
@@ -208,23 +156,16 @@ void HINKE029A10::update(void)
 
   _writeCommand(0x24); // Write B/W
 
-  for (uint32_t i = 0; i < HINKE029A10_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _black_buffer, sizeof(_black_buffer), 0, HINKE029A10_BUFFER_SIZE, true);
 
   set_xy_window(0, 15, 0, 295);
   set_xy_counter(0, 0);
 
   _writeCommand(0x26); // Write RED
 
-  for (uint32_t i = 0; i < HINKE029A10_BUFFER_SIZE; i++)
-  {
-    _writeData((i < sizeof(_red_buffer)) ? ~_red_buffer[i] : 0xFF);
-  }
+  writeBufferData(IO, _red_buffer, sizeof(_red_buffer), 0, HINKE029A10_BUFFER_SIZE, true);
 
-  _writeCommand(0x22);
-  _writeData(0xC7);
+  IO.writeCommandData(0x22, 0xC7);
   _writeCommand(0x20);
 
   _waitWhileBusy("SEND DONE");
@@ -234,23 +175,33 @@ void HINKE029A10::update(void)
 
 void HINKE029A10::set_xy_window(unsigned char xs, unsigned char xe, unsigned int ys, unsigned int ye)
 {
-  _writeCommand(0x44); // set RAM x address start/end, in page 36
-  _writeData(xs);      // RAM x address start at 00h;
-  _writeData(xe);      // RAM x address end at 0fh(12+1)*8->104
-  _writeCommand(0x45); // set RAM y address start/end, in page 37
-  _writeData(ys);      // RAM y address start at 0;
-  _writeData(ys >> 8);
-  _writeData(ye);      // RAM y address end at
-  _writeData(ye >> 8); // RAM y address end at
+  {
+    const uint8_t data[] =
+    {
+      xs, // RAM x address start at 00h;
+      xe // RAM x address end at 0fh(12+1)*8->104
+    };
+    IO.writeCommandData(0x44, data, sizeof(data)); // set RAM x address start/end, in page 36
+  }
+  {
+    const uint8_t data[] =
+    {
+      uint8_t(ys), // RAM y address start at 0;
+      uint8_t(ys >> 8),
+      uint8_t(ye), // RAM y address end at
+      uint8_t(ye >> 8) // RAM y address end at
+    };
+    IO.writeCommandData(0x45, data, sizeof(data)); // set RAM y address start/end, in page 37
+  }
 }
 
 void HINKE029A10::set_xy_counter(unsigned char x, unsigned char y)
 {
-  _writeCommand(0x4E); // set RAM x address count
-  _writeData(x);
-  _writeCommand(0x4F); // set RAM y address count
-  _writeData(y);
-  _writeData(y >> 8);
+  IO.writeCommandData(0x4E, x); // set RAM x address count
+  {
+    const uint8_t data[] = {y, uint8_t(y >> 8)};
+    IO.writeCommandData(0x4F, data, sizeof(data)); // set RAM y address count
+  }
 }
 
 void HINKE029A10::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode)
@@ -262,22 +213,26 @@ void HINKE029A10::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint
 
 void HINKE029A10::drawExamplePicture(const uint8_t *black_bitmap, const uint8_t *red_bitmap, uint32_t black_size, uint32_t red_size)
 {
+  invalidateShadow();
   drawPicture(black_bitmap, red_bitmap, black_size, red_size, bm_invert_red);
 }
 
 void HINKE029A10::drawPicture(const uint8_t *black_bitmap, const uint8_t *red_bitmap, uint32_t black_size, uint32_t red_size, int16_t mode)
 {
+  invalidateShadow();
   drawBitmapBM(black_bitmap, 0, 0, HINKE029A10_WIDTH, HINKE029A10_HEIGHT, GxEPD_BLACK, mode);
   drawBitmapBM(red_bitmap, 0, 0, HINKE029A10_WIDTH, HINKE029A10_HEIGHT, GxEPD_RED, mode);
 }
 
 void HINKE029A10::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode)
 {
+  invalidateShadow();
   drawBitmapBM(bitmap, 0, 0, HINKE029A10_WIDTH, HINKE029A10_HEIGHT, GxEPD_BLACK, mode);
 }
 
 void HINKE029A10::eraseDisplay(bool using_partial_update)
 {
+  invalidateShadow();
   if (_current_page != -1)
     return;
   if (using_partial_update)
@@ -288,17 +243,11 @@ void HINKE029A10::eraseDisplay(bool using_partial_update)
     IO.writeCommandTransaction(0x91); // partial in
     _setPartialRamArea(0, 0, HINKE029A10_WIDTH - 1, HINKE029A10_HEIGHT - 1);
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < HINKE029A10_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, HINKE029A10_BUFFER_SIZE * 2); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < HINKE029A10_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, HINKE029A10_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x12); // display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     IO.writeCommandTransaction(0x92); // partial out
   }
   else
@@ -306,23 +255,18 @@ void HINKE029A10::eraseDisplay(bool using_partial_update)
     _using_partial_mode = false; // remember
     _wakeUp();
     _writeCommand(0x10);
-    for (uint32_t i = 0; i < HINKE029A10_BUFFER_SIZE * 2; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, HINKE029A10_BUFFER_SIZE * 2); // white is 0xFF on device
     _writeCommand(0x13);
-    for (uint32_t i = 0; i < HINKE029A10_BUFFER_SIZE; i++)
-    {
-      _writeData(0xFF); // white is 0xFF on device
-    }
+    GxIO_Burst(IO).fill(0xFF, HINKE029A10_BUFFER_SIZE); // white is 0xFF on device
     _writeCommand(0x12); // display refresh
-    _waitWhileBusy("eraseDisplay");
+    _waitWhileBusy("eraseDisplay", wait_refresh);
     _sleep();
   }
 }
 
 void HINKE029A10::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (_current_page != -1)
     return;
   if (using_rotation)
@@ -363,37 +307,28 @@ void HINKE029A10::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, b
   IO.writeCommandTransaction(0x10);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (HINKE029A10_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data);                                           // white is 0xFF on device
-    }
+    writeBufferData(IO, _black_buffer, sizeof(_black_buffer), y1 * (HINKE029A10_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
   }
   IO.writeCommandTransaction(0x13);
   for (int16_t y1 = y; y1 <= ye; y1++)
   {
-    for (int16_t x1 = xs_bx; x1 < xe_bx; x1++)
-    {
-      uint16_t idx = y1 * (HINKE029A10_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data);                                       // white is 0xFF on device
-    }
+    writeBufferData(IO, _red_buffer, sizeof(_red_buffer), y1 * (HINKE029A10_WIDTH / 8) + xs_bx, xe_bx - xs_bx, true);
   }
   IO.writeCommandTransaction(0x12); // display refresh
-  _waitWhileBusy("updateWindow");
+  _waitWhileBusy("updateWindow", wait_partial_refresh);
   IO.writeCommandTransaction(0x92); // partial out
   delay(HINKE029A10_PU_DELAY);      // don't stress this display
 }
 
 void HINKE029A10::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation)
 {
+  invalidateShadow();
   if (!_using_partial_mode)
     _wakeUp();
   _using_partial_mode = true;
   _writeToWindow(xs, ys, xd, yd, w, h, using_rotation);
   IO.writeCommandTransaction(0x12); // display refresh
-  _waitWhileBusy("updateToWindow");
+  _waitWhileBusy("updateToWindow", wait_partial_refresh);
   delay(HINKE029A10_PU_DELAY); // don't stress this display
 }
 
@@ -444,22 +379,12 @@ void HINKE029A10::_writeToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t
   IO.writeCommandTransaction(0x10);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (HINKE029A10_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_black_buffer)) ? _black_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data);                                           // white is 0xFF on device
-    }
+    writeBufferData(IO, _black_buffer, sizeof(_black_buffer), y1 * (HINKE029A10_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
   }
   IO.writeCommandTransaction(0x13);
   for (int16_t y1 = ys; y1 <= yse; y1++)
   {
-    for (int16_t x1 = xss_d8; x1 < xse_d8; x1++)
-    {
-      uint16_t idx = y1 * (HINKE029A10_WIDTH / 8) + x1;
-      uint8_t data = (idx < sizeof(_red_buffer)) ? _red_buffer[idx] : 0x00; // white is 0x00 in buffer
-      IO.writeDataTransaction(~data);                                       // white is 0xFF on device
-    }
+    writeBufferData(IO, _red_buffer, sizeof(_red_buffer), y1 * (HINKE029A10_WIDTH / 8) + xss_d8, xse_d8 - xss_d8, true);
   }
   IO.writeCommandTransaction(0x92); // partial out
 }
@@ -474,16 +399,21 @@ uint16_t HINKE029A10::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t xe, ui
 {
   x &= 0xFFF8;                      // byte boundary
   xe = (xe - 1) | 0x0007;           // byte boundary - 1
-  IO.writeCommandTransaction(0x90); // partial window
-  // IO.writeDataTransaction(x / 256);
-  IO.writeDataTransaction(x % 256);
-  // IO.writeDataTransaction(xe / 256);
-  IO.writeDataTransaction(xe % 256);
-  IO.writeDataTransaction(y / 256);
-  IO.writeDataTransaction(y % 256);
-  IO.writeDataTransaction(ye / 256);
-  IO.writeDataTransaction(ye % 256);
-  IO.writeDataTransaction(0x01); // don't see any difference
+  {
+    const uint8_t data[] =
+    {
+      //uint8_t(x / 256),
+      uint8_t(x % 256),
+      //uint8_t(xe / 256),
+      uint8_t(xe % 256),
+      uint8_t(y / 256),
+      uint8_t(y % 256),
+      uint8_t(ye / 256),
+      uint8_t(ye % 256),
+      0x01 // don't see any difference
+    };
+    IO.writeCommandData(0x90, data, sizeof(data)); // partial window
+  }
   // IO.writeDataTransaction(0x00); // don't see any difference
   return (7 + xe - x) / 8; // number of bytes to transfer per line
 }
@@ -498,18 +428,20 @@ void HINKE029A10::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void HINKE029A10::_waitWhileBusy(const char *comment)
+void HINKE029A10::_waitWhileBusy(const char *comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 0)
       break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 30000000) // >14.9s !
     {
       if (_diag_enabled)
         Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -526,6 +458,7 @@ void HINKE029A10::_waitWhileBusy(const char *comment)
 #endif
   }
   (void)start;
+  onBusyWaitDone();
 }
 
 void HINKE029A10::_wakeUp()
@@ -536,33 +469,30 @@ void HINKE029A10::_wakeUp()
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, HIGH, 10); // 10ms if no BUSY
   }
   /*
-    _writeCommand(0x06);
-    _writeData (0x17);
-    _writeData (0x17);
-    _writeData (0x17);
+    {
+      const uint8_t data[] = {0x17, 0x17, 0x17};
+      IO.writeCommandData(0x06, data, sizeof(data));
+    }
     _writeCommand(0x04);
-    _waitWhileBusy("_wakeUp Power On");
-    _writeCommand(0X00);
-    _writeData(0x8f);
-    _writeCommand(0X50);
-    _writeData(0x77);
-    _writeCommand(0x61);
-    _writeData (0x80);
-    _writeData (0x01);
-    _writeData (0x28);
+    _waitWhileBusy("_wakeUp Power On", wait_power_on);
+    IO.writeCommandData(0X00, 0x8f);
+    IO.writeCommandData(0X50, 0x77);
+    {
+      const uint8_t data[] = {0x80, 0x01, 0x28};
+      IO.writeCommandData(0x61, data, sizeof(data));
+    }
     */
 }
 
 void HINKE029A10::_sleep(void)
 {
-  _waitWhileBusy("_sleep Going to sleep.");
+  _waitWhileBusy("_sleep Going to sleep.", wait_power_off);
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // sleep!
-    _writeData(0x11);
+    IO.writeCommandData(0x10, 0x11); // sleep!
   }
 }
 
@@ -588,33 +518,34 @@ void HINKE029A10::_rotate(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h)
 }
 void HINKE029A10::drawCornerTest(uint8_t em)
 {
+  invalidateShadow();
   if (_current_page != -1)
     return;
   _using_partial_mode = false;
   _wakeUp();
   _writeCommand(0x10);
-  for (uint32_t y = 0; y < HINKE029A10_HEIGHT; y++)
   {
-    for (uint32_t x = 0; x < HINKE029A10_WIDTH / 8; x++)
+    GxIO_Burst burst(IO);
+    for (uint32_t y = 0; y < HINKE029A10_HEIGHT; y++)
     {
-      uint8_t data = 0xFF; // white is 0xFF on device
-      if ((x < 1) && (y < 8))
-        data = 0x00;
-      if ((x > HINKE029A10_WIDTH / 8 - 3) && (y < 16))
-        data = 0x00;
-      if ((x > HINKE029A10_WIDTH / 8 - 4) && (y > HINKE029A10_HEIGHT - 25))
-        data = 0x00;
-      if ((x < 4) && (y > HINKE029A10_HEIGHT - 33))
-        data = 0x00;
-      _writeData(data);
+      for (uint32_t x = 0; x < HINKE029A10_WIDTH / 8; x++)
+      {
+        uint8_t data = 0xFF; // white is 0xFF on device
+        if ((x < 1) && (y < 8))
+          data = 0x00;
+        if ((x > HINKE029A10_WIDTH / 8 - 3) && (y < 16))
+          data = 0x00;
+        if ((x > HINKE029A10_WIDTH / 8 - 4) && (y > HINKE029A10_HEIGHT - 25))
+          data = 0x00;
+        if ((x < 4) && (y > HINKE029A10_HEIGHT - 33))
+          data = 0x00;
+        burst.write(data);
+      }
     }
   }
   _writeCommand(0x13);
-  for (uint32_t i = 0; i < HINKE029A10_BUFFER_SIZE; i++)
-  {
-    _writeData(0xFF); // white is 0xFF on device
-  }
+  GxIO_Burst(IO).fill(0xFF, HINKE029A10_BUFFER_SIZE); // white is 0xFF on device
   _writeCommand(0x12); // display refresh
-  _waitWhileBusy("drawCornerTest");
+  _waitWhileBusy("drawCornerTest", wait_refresh);
   _sleep();
 }
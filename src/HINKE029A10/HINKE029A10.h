@@ -24,7 +24,6 @@ public:
 #else
   HINKE029A10(GxIO &io, int8_t rst = 9, int8_t busy = 7);
 #endif
-  void drawPixel(int16_t x, int16_t y, uint16_t color);
   void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
   void fillScreen(uint16_t color);             // to buffer
   void update(void);
@@ -72,7 +71,7 @@ private:
   void _writeCommand(uint8_t command);
   void _wakeUp();
   void _sleep();
-  void _waitWhileBusy(const char *comment = 0);
+  void _waitWhileBusy(const char *comment = 0, busy_wait wait = wait_other);
   void _rotate(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h);
 
 private:
@@ -85,8 +85,9 @@ void HINKE029A14::init(uint32_t serial_diag_bitrate)
     Serial.begin(serial_diag_bitrate);
     _diag_enabled = true;
   }
+  IO.setBusyPin(_busy, HIGH);
   IO.init();
-  IO.setFrequency(4000000); // 4MHz
+  selectSPIFrequency(IO, GxEPD_SPI_CLOCK_IL);
   if (_rst >= 0)
   {
     digitalWrite(_rst, HIGH);
@@ -110,17 +111,19 @@ void HINKE029A14::fillScreen(uint16_t color)
     _black_buffer[x] = black;
     _red_buffer[x] = red;
   }
+  bufferFilled(color);
 }
 
 void HINKE029A14::update(void)
 {
+  bufferUpdated();
  // reset required for wakeup
   if (_rst >= 0)
   {
     digitalWrite(_rst, 0);
     delay(10);
     digitalWrite(_rst, 1);
-    delay(10);
+    GxIO::waitReady(_busy, HIGH, 10); // 10ms if no BUSY
   }
 //2.9" Display:
 
@@ -128,80 +131,67 @@ void HINKE029A14::update(void)
   _waitWhileBusy("SendResetfirst");
   delay(5);
 
-  _writeCommand(0x74);
-  _writeData (0x54);
-
-  _writeCommand(0x7E);
-  _writeData (0x3B);
-
-  _writeCommand(0x2B);
-  _writeData (0x04);
-  _writeData (0x63);
-
-  _writeCommand(0x0C);
-  _writeData (0x8F);
-  _writeData (0x8F);
-  _writeData (0x8F);
-  _writeData (0x3F);
-
-  _writeCommand(0x01);
-  _writeData (0x27);
-  _writeData (0x01);
-  _writeData (0x00);
-
-  _writeCommand(0x11);
-  _writeData (0x01);
-
-  _writeCommand(0x44);
-  _writeData (0x00);
-  _writeData (0x0F);
-
-  _writeCommand(0x45);
-  _writeData (0x27);
-  _writeData (0x01);
-  _writeData (0x00);
-  _writeData (0x00);
-
-  _writeCommand (0x3C);
-  _writeData (0xC0);
-  _writeCommand (0x18);
-  _writeData (0x80);
-  _writeCommand (0x22);
-  _writeData (0xB1);
+  IO.writeCommandData(0x74, 0x54);
+
+  IO.writeCommandData(0x7E, 0x3B);
+
+  {
+    const uint8_t data[] = {0x04, 0x63};
+    IO.writeCommandData(0x2B, data, sizeof(data));
+  }
+
+  {
+    const uint8_t data[] = {0x8F, 0x8F, 0x8F, 0x3F};
+    IO.writeCommandData(0x0C, data, sizeof(data));
+  }
+
+  {
+    const uint8_t data[] = {0x27, 0x01, 0x00};
+    IO.writeCommandData(0x01, data, sizeof(data));
+  }
+
+  IO.writeCommandData(0x11, 0x01);
+
+  {
+    const uint8_t data[] = {0x00, 0x0F};
+    IO.writeCommandData(0x44, data, sizeof(data));
+  }
+
+  {
+    const uint8_t data[] = {0x27, 0x01, 0x00, 0x00};
+    IO.writeCommandData(0x45, data, sizeof(data));
+  }
+
+  IO.writeCommandData(0x3C, 0xC0);
+  IO.writeCommandData(0x18, 0x80);
+  IO.writeCommandData(0x22, 0xB1);
   _writeCommand (0x20);
   _waitWhileBusy("SendResetmiddle");
   delay(5);
    
-  _writeCommand (0x4E);
-  _writeData (0x00);
-
-  _writeCommand (0x4F);
-  _writeData (0x27);
-  _writeData (0x01);
+  IO.writeCommandData(0x4E, 0x00);
 
-  _writeCommand (0x26);
-
-  for (uint32_t i = 0; i < HINKE029A14_BUFFER_SIZE; i++)
   {
-    _writeData((i < sizeof(_red_buffer)) ? ~_red_buffer[i] : 0xFF);
+    const uint8_t data[] = {0x27, 0x01};
+    IO.writeCommandData(0x4F, data, sizeof(data));
   }
 
-  _writeCommand (0x4E);
-  _writeData (0x00);
+  _writeCommand (0x26);
 
-  _writeCommand (0x4F);
-  _writeData (0x27);
-  _writeData (0x01);
+  writeBufferData(IO, _red_buffer, sizeof(_red_buffer), 0, HINKE029A14_BUFFER_SIZE, true);
 
-  _writeCommand (0x24);
+  IO.writeCommandData(0x4E, 0x00);
 
-  for (uint32_t i = 0; i < HINKE029A14_BUFFER_SIZE; i++)
   {
-    _writeData((i < sizeof(_black_buffer)) ? ~_black_buffer[i] : 0xFF);
+    const uint8_t data[] = {0x27, 0x01};
+    IO.writeCommandData(0x4F, data, sizeof(data));
   }
 
-  _writeCommand (0x22);
-  _writeData (0xC7);
+  _writeCommand (0x24);
+
+  writeBufferData(IO, _black_buffer, sizeof(_black_buffer), 0, HINKE029A14_BUFFER_SIZE, true);
+
+  IO.writeCommandData(0x22, 0xC7);
 
   _writeCommand (0x20);
   _waitWhileBusy("SEND DONE");
@@ -218,16 +208,18 @@ void HINKE029A14::_writeData(uint8_t data)
   IO.writeDataTransaction(data);
 }
 
-void HINKE029A14::_waitWhileBusy(const char* comment)
+void HINKE029A14::_waitWhileBusy(const char* comment, busy_wait wait)
 {
+  onBusyWait(wait, _busy);
   unsigned long start = micros();
   while (1)
   {
     if (digitalRead(_busy) == 0) break;
-    delay(1);
+    busyIdle();
     if (micros() - start > 30000000) // >14.9s !
     {
       if (_diag_enabled) Serial.println("Busy Timeout!");
+      onBusyTimeout();
       break;
     }
   }
@@ -244,6 +236,7 @@ void HINKE029A14::_waitWhileBusy(const char* comment)
 #endif
   }
   (void) start;
+  onBusyWaitDone();
 }
 
 void HINKE029A14::_rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
@@ -28,6 +28,7 @@ class HINKE029A14 : public GxEPD
     void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
     void fillScreen(uint16_t color); // to buffer
     void update(void);
+    bool hasUpdateWindow() {return false;}; // no partial update
     // to buffer, may be cropped, drawPixel() used, update needed
     void drawExamplePicture(const uint8_t* black_bitmap, const uint8_t* red_bitmap, uint32_t black_size, uint32_t red_size);
     // to full screen, filled with white if size is less, no update needed, black  /white / red, general version
@@ -44,7 +45,7 @@ class HINKE029A14 : public GxEPD
     }
     void _writeData(uint8_t data);
     void _writeCommand(uint8_t command);
-    void _waitWhileBusy(const char* comment = 0);
+    void _waitWhileBusy(const char* comment = 0, busy_wait wait = wait_other);
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h);
   private:
 #if defined(__AVR)
@@ -28,6 +28,7 @@ public:
   void init(uint32_t serial_diag_bitrate = 0); // = 0 : disabled
   void fillScreen(uint16_t color);             // to buffer
   void update(void);
+  bool hasUpdateWindow() {return false;}; // no partial update
   // to buffer, may be cropped, drawPixel() used, update needed
   void drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode = bm_normal);
   // to buffer, may be cropped, drawPixel() used, update needed
@@ -53,7 +54,7 @@ private:
   void _writeCommand(uint8_t command);
   void _wakeUp();
   void _sleep();
-  void _waitWhileBusy(const char *comment = 0);
+  void _waitWhileBusy(const char *comment = 0, busy_wait wait = wait_other);
   void _rotate(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h);
 
 private: